@@ -102,61 +102,35 @@ Item {
         The required thickness (width for vertical, height for horizontal) to fit all content.
         Uses maxInkWidth which matches Glyph's normalized ink (always starts at x=0).
         This guarantees no label will ever be clipped or eat into the tick gap.
+        Updated once per frame by the axis layout.
     */
-    readonly property real requiredThickness: {
-        if (!showTickLabels) {
-            return tickLength;
-        }
-
-        if (isVertical) {
-            // Since Glyph normalizes ink to start at x=0, item width = ink width
-            // Both LEFT and RIGHT axes need the same space: maxInkWidth
-            var maxWidth = GlyphMetrics.maxInkWidth(ticks, decimalPoints, fontFamily, fontSize);
-            return Math.ceil(tickLength + labelGap + maxWidth);
-        } else {
-            // For horizontal axes, use text height
-            var h = GlyphMetrics.textHeight(fontFamily, fontSize);
-            return Math.ceil(tickLength + labelGap + h);
-        }
-    }
+    readonly property real requiredThickness: axisLayout.requiredThickness
 
     /*!
         Computed tick positions with spine and end points for each tick.
         Used internally for rendering tick marks and labels.
+        Updated once per frame by the axis layout.
     */
-    readonly property var tickPositions: {
-        var positions = [];
-        var numTicks = ticks.length;
-
-        for (var i = 0; i < numTicks; i++) {
-            var pos = (numTicks === 1) ? 0.5 : (i / (numTicks - 1));
-
-            if (isHorizontal) {
-                var x = Math.round(pos * (width - 1)) + 0.5;
-                var spineY = direction === Axis.Direction.Bottom ? 0.5 : height - 0.5;
-                var endY = direction === Axis.Direction.Bottom ? tickLength - 0.5 : height - tickLength + 0.5;
-                positions.push({
-                    spinePoint: Qt.point(x, spineY),
-                    endPoint: Qt.point(x, endY),
-                    value: ticks[i]
-                });
-            } else {
-                var y = Math.round((1 - pos) * (height - 1)) + 0.5;
-                var spineX = direction === Axis.Direction.Right ? 0.5 : width - 0.5;
-                var endX = direction === Axis.Direction.Right ? tickLength - 0.5 : width - tickLength + 0.5;
-                positions.push({
-                    spinePoint: Qt.point(spineX, y),
-                    endPoint: Qt.point(endX, y),
-                    value: ticks[i]
-                });
-            }
-        }
-        return positions;
-    }
+    readonly property var tickPositions: axisLayout.tickPositions
 
     implicitWidth: isVertical ? requiredThickness : 200
     implicitHeight: isHorizontal ? requiredThickness : 200
 
+    // Coalesces every input and size change into one layout pass per frame,
+    // done in the same polish that positions the axis itself
+    AxisLayout {
+        id: axisLayout
+        anchors.fill: parent
+        direction: root.direction
+        ticks: root.ticks
+        tickLength: root.tickLength
+        labelGap: root.labelGap
+        showTickLabels: root.showTickLabels
+        decimalPoints: root.decimalPoints
+        fontFamily: root.fontFamily
+        fontSize: root.fontSize
+    }
+
     // Axis line
     Shape {
         visible: root.showSpine
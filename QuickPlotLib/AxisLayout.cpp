@@ -0,0 +1,239 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#include "AxisLayout.hpp"
+
+#include "GlyphMetrics.hpp"
+
+#include <QPointF>
+#include <QQmlEngine>
+#include <QVariantMap>
+#include <QtMath>
+
+#include <cmath>
+#include <utility>
+
+namespace {
+
+// JavaScript Math.round(): halves round towards +infinity
+double jsRound(double value)
+{
+    return std::floor(value + 0.5);
+}
+
+} // namespace
+
+AxisLayout::AxisLayout(QQuickItem *parent)
+    : QQuickItem(parent)
+{
+}
+
+AxisLayout::~AxisLayout() = default;
+
+void AxisLayout::setDirection(int direction)
+{
+    if (m_direction == direction) {
+        return;
+    }
+    m_direction = direction;
+    invalidateThickness();
+    invalidatePositions();
+    emit directionChanged();
+}
+
+void AxisLayout::setTicks(const QVariantList &ticks)
+{
+    if (m_ticks == ticks) {
+        return;
+    }
+    m_ticks = ticks;
+    invalidateThickness();
+    invalidatePositions();
+    emit ticksChanged();
+}
+
+void AxisLayout::setTickLength(int length)
+{
+    if (m_tickLength == length) {
+        return;
+    }
+    m_tickLength = length;
+    invalidateThickness();
+    invalidatePositions();
+    emit tickLengthChanged();
+}
+
+void AxisLayout::setLabelGap(int gap)
+{
+    if (m_labelGap == gap) {
+        return;
+    }
+    m_labelGap = gap;
+    invalidateThickness();
+    emit labelGapChanged();
+}
+
+void AxisLayout::setShowTickLabels(bool show)
+{
+    if (m_showTickLabels == show) {
+        return;
+    }
+    m_showTickLabels = show;
+    invalidateThickness();
+    emit showTickLabelsChanged();
+}
+
+void AxisLayout::setDecimalPoints(int decimalPoints)
+{
+    if (m_decimalPoints == decimalPoints) {
+        return;
+    }
+    m_decimalPoints = decimalPoints;
+    invalidateThickness();
+    emit decimalPointsChanged();
+}
+
+void AxisLayout::setFontFamily(const QString &family)
+{
+    if (m_fontFamily == family) {
+        return;
+    }
+    m_fontFamily = family;
+    invalidateThickness();
+    emit fontFamilyChanged();
+}
+
+void AxisLayout::setFontSize(int size)
+{
+    if (m_fontSize == size) {
+        return;
+    }
+    m_fontSize = size;
+    invalidateThickness();
+    emit fontSizeChanged();
+}
+
+void AxisLayout::invalidateThickness()
+{
+    m_thicknessDirty = true;
+    polish();
+}
+
+void AxisLayout::invalidatePositions()
+{
+    m_positionsDirty = true;
+    polish();
+}
+
+void AxisLayout::geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickItem::geometryChange(newGeometry, oldGeometry);
+    if (newGeometry.size() != oldGeometry.size()) {
+        invalidatePositions();
+    }
+}
+
+void AxisLayout::componentComplete()
+{
+    QQuickItem::componentComplete();
+
+    // Lay out before the axis is first shown so its implicit size is known
+    // to whatever positions it; later changes wait for the next polish
+    updatePolish();
+}
+
+void AxisLayout::updatePolish()
+{
+    if (!m_thicknessDirty && !m_positionsDirty) {
+        return;
+    }
+    if (!metrics()) {
+        qWarning("AxisLayout: no GlyphMetrics singleton; create AxisLayout in a QML engine");
+        return;
+    }
+
+    bool changed = false;
+    if (m_thicknessDirty) {
+        const qreal thickness = computeRequiredThickness();
+        changed = thickness != m_requiredThickness;
+        m_requiredThickness = thickness;
+        m_thicknessDirty = false;
+    }
+    if (m_positionsDirty) {
+        QVariantList positions = computeTickPositions();
+        changed = changed || positions != m_tickPositions;
+        m_tickPositions = std::move(positions);
+        m_positionsDirty = false;
+    }
+
+    if (changed) {
+        emit layoutChanged();
+    }
+}
+
+GlyphMetrics *AxisLayout::metrics()
+{
+    // Share the engine's singleton and its caches with every other axis
+    if (!m_metrics) {
+        if (QQmlEngine *engine = qmlEngine(this)) {
+            m_metrics = engine->singletonInstance<GlyphMetrics *>("QuickPlotLib", "GlyphMetrics");
+        }
+    }
+    return m_metrics;
+}
+
+qreal AxisLayout::computeRequiredThickness()
+{
+    if (!m_showTickLabels) {
+        return m_tickLength;
+    }
+
+    if (m_direction == Left || m_direction == Right) {
+        // Since Glyph normalizes ink to start at x=0, item width = ink width
+        // Both LEFT and RIGHT axes need the same space: maxInkWidth
+        const qreal maxWidth = metrics()->maxInkWidth(m_ticks, m_decimalPoints, m_fontFamily, m_fontSize);
+        return qCeil(m_tickLength + m_labelGap + maxWidth);
+    }
+
+    // For horizontal axes, use text height
+    const qreal h = metrics()->textHeight(m_fontFamily, m_fontSize);
+    return qCeil(m_tickLength + m_labelGap + h);
+}
+
+QVariantList AxisLayout::computeTickPositions() const
+{
+    QVariantList positions;
+    const qsizetype numTicks = m_ticks.size();
+    positions.reserve(numTicks);
+
+    const bool horizontal = m_direction == Top || m_direction == Bottom;
+    const double w = width();
+    const double h = height();
+
+    for (qsizetype i = 0; i < numTicks; ++i) {
+        const double pos = numTicks == 1 ? 0.5 : double(i) / double(numTicks - 1);
+
+        QPointF spinePoint;
+        QPointF endPoint;
+        if (horizontal) {
+            const double x = jsRound(pos * (w - 1)) + 0.5;
+            const double spineY = m_direction == Bottom ? 0.5 : h - 0.5;
+            const double endY = m_direction == Bottom ? m_tickLength - 0.5 : h - m_tickLength + 0.5;
+            spinePoint = QPointF(x, spineY);
+            endPoint = QPointF(x, endY);
+        } else {
+            const double y = jsRound((1 - pos) * (h - 1)) + 0.5;
+            const double spineX = m_direction == Right ? 0.5 : w - 0.5;
+            const double endX = m_direction == Right ? m_tickLength - 0.5 : w - m_tickLength + 0.5;
+            spinePoint = QPointF(spineX, y);
+            endPoint = QPointF(endX, y);
+        }
+
+        positions.append(QVariantMap {
+            { QStringLiteral("spinePoint"), spinePoint },
+            { QStringLiteral("endPoint"), endPoint },
+            { QStringLiteral("value"), m_ticks.at(i) },
+        });
+    }
+    return positions;
+}
@@ -0,0 +1,167 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QPointer>
+#include <QQuickItem>
+#include <QString>
+#include <QVariantList>
+#include <QtQml/qqmlregistration.h>
+
+class GlyphMetrics;
+
+/*!
+    \qmltype AxisLayout
+    \inqmlmodule QuickPlotLib
+    \inherits QQuickItem
+    \brief Computes an Axis' tick positions and required thickness once per frame.
+
+    Axis fills itself with an AxisLayout and binds its inputs to it. Every
+    input change, including a resize, only requests a polish; the layout is
+    computed in updatePolish(), right before the frame is synchronized, and
+    published with a single layoutChanged(). Setting a dozen axis properties
+    therefore measures the tick labels once, and a live resize moves ticks
+    and labels in the same frame as the axis itself.
+
+    Tick labels are measured through the GlyphMetrics singleton, so they
+    share its font and shaping caches with every other axis. An AxisLayout
+    created outside a QML engine has no singleton and does not lay out.
+
+    \sa Axis, GlyphMetrics
+*/
+class AxisLayout : public QQuickItem {
+    Q_OBJECT
+    QML_ELEMENT
+
+    /*!
+        The axis direction, an Axis.Direction value.
+    */
+    Q_PROPERTY(int direction READ direction WRITE setDirection NOTIFY directionChanged)
+
+    /*!
+        Tick values, evenly spaced along the axis.
+    */
+    Q_PROPERTY(QVariantList ticks READ ticks WRITE setTicks NOTIFY ticksChanged)
+
+    /*!
+        Tick length in pixels.
+    */
+    Q_PROPERTY(int tickLength READ tickLength WRITE setTickLength NOTIFY tickLengthChanged)
+
+    /*!
+        Gap in pixels between tick marks and labels.
+    */
+    Q_PROPERTY(int labelGap READ labelGap WRITE setLabelGap NOTIFY labelGapChanged)
+
+    /*!
+        Whether tick labels are shown and need room.
+    */
+    Q_PROPERTY(bool showTickLabels READ showTickLabels WRITE setShowTickLabels NOTIFY showTickLabelsChanged)
+
+    /*!
+        Number of decimal points of the tick labels.
+    */
+    Q_PROPERTY(int decimalPoints READ decimalPoints WRITE setDecimalPoints NOTIFY decimalPointsChanged)
+
+    /*!
+        Tick label font family.
+    */
+    Q_PROPERTY(QString fontFamily READ fontFamily WRITE setFontFamily NOTIFY fontFamilyChanged)
+
+    /*!
+        Tick label font pixel size.
+    */
+    Q_PROPERTY(int fontSize READ fontSize WRITE setFontSize NOTIFY fontSizeChanged)
+
+    /*!
+        The thickness (width for vertical, height for horizontal axes) needed
+        to fit ticks and labels. Read-only.
+    */
+    Q_PROPERTY(qreal requiredThickness READ requiredThickness NOTIFY layoutChanged)
+
+    /*!
+        One entry per tick with its spinePoint, endPoint and value, in item
+        coordinates. Read-only.
+    */
+    Q_PROPERTY(QVariantList tickPositions READ tickPositions NOTIFY layoutChanged)
+
+public:
+    explicit AxisLayout(QQuickItem *parent = nullptr);
+    ~AxisLayout() override;
+
+    int direction() const { return m_direction; }
+    void setDirection(int direction);
+
+    QVariantList ticks() const { return m_ticks; }
+    void setTicks(const QVariantList &ticks);
+
+    int tickLength() const { return m_tickLength; }
+    void setTickLength(int length);
+
+    int labelGap() const { return m_labelGap; }
+    void setLabelGap(int gap);
+
+    bool showTickLabels() const { return m_showTickLabels; }
+    void setShowTickLabels(bool show);
+
+    int decimalPoints() const { return m_decimalPoints; }
+    void setDecimalPoints(int decimalPoints);
+
+    QString fontFamily() const { return m_fontFamily; }
+    void setFontFamily(const QString &family);
+
+    int fontSize() const { return m_fontSize; }
+    void setFontSize(int size);
+
+    qreal requiredThickness() const { return m_requiredThickness; }
+    QVariantList tickPositions() const { return m_tickPositions; }
+
+signals:
+    void directionChanged();
+    void ticksChanged();
+    void tickLengthChanged();
+    void labelGapChanged();
+    void showTickLabelsChanged();
+    void decimalPointsChanged();
+    void fontFamilyChanged();
+    void fontSizeChanged();
+    void layoutChanged();
+
+protected:
+    void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    void componentComplete() override;
+    void updatePolish() override;
+
+private:
+    // Same order as the Axis.Direction QML enum
+    enum Direction {
+        Left,
+        Right,
+        Top,
+        Bottom
+    };
+
+    void invalidateThickness();
+    void invalidatePositions();
+    GlyphMetrics *metrics();
+    qreal computeRequiredThickness();
+    QVariantList computeTickPositions() const;
+
+    int m_direction = Bottom;
+    QVariantList m_ticks;
+    int m_tickLength = 8;
+    int m_labelGap = 4;
+    bool m_showTickLabels = true;
+    int m_decimalPoints = 2;
+    QString m_fontFamily = "sans-serif";
+    int m_fontSize = 12;
+
+    // Outputs and what needs recomputing in the next polish
+    qreal m_requiredThickness = 0;
+    QVariantList m_tickPositions;
+    bool m_thicknessDirty = true;
+    bool m_positionsDirty = true;
+
+    QPointer<GlyphMetrics> m_metrics;
+};
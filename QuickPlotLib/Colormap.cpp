@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#include "Colormap.hpp"
+
+#include <QColor>
+#include <QQuickWindow>
+#include <QSGTexture>
+#include <QtDebug>
+
+#include <array>
+
+namespace {
+
+struct ColormapStops {
+    const char *name;
+    std::array<QRgb, 11> stops; // Evenly spaced from 0.0 to 1.0
+};
+
+// Sampled at 0.0, 0.1, ..., 1.0 from the matplotlib reference maps
+const ColormapStops kColormaps[] = {
+    { "viridis",
+      { 0x440154, 0x482475, 0x414487, 0x355f8d, 0x2a788e, 0x21918c,
+        0x22a884, 0x44bf70, 0x7ad151, 0xbddf26, 0xfde725 } },
+    { "magma",
+      { 0x000004, 0x140e36, 0x3b0f70, 0x641a80, 0x8c2981, 0xb73779,
+        0xde4968, 0xf7705c, 0xfe9f6d, 0xfecf92, 0xfcfdbf } },
+    { "inferno",
+      { 0x000004, 0x160b39, 0x420a68, 0x6a176e, 0x932667, 0xbc3754,
+        0xdd513a, 0xf37819, 0xfca50a, 0xf6d746, 0xfcffa4 } },
+    { "plasma",
+      { 0x0d0887, 0x41049d, 0x6a00a8, 0x8f0da4, 0xb12a90, 0xcc4778,
+        0xe16462, 0xf2844b, 0xfca636, 0xfcce25, 0xf0f921 } },
+    { "gray",
+      { 0x000000, 0x1a1a1a, 0x333333, 0x4d4d4d, 0x666666, 0x808080,
+        0x999999, 0xb3b3b3, 0xcccccc, 0xe6e6e6, 0xffffff } },
+};
+
+const ColormapStops *findColormap(const QString &name)
+{
+    for (const ColormapStops &cmap : kColormaps) {
+        if (name == QLatin1String(cmap.name)) {
+            return &cmap;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+QStringList Colormap::names()
+{
+    QStringList result;
+    for (const ColormapStops &cmap : kColormaps) {
+        result.append(QString::fromLatin1(cmap.name));
+    }
+    return result;
+}
+
+bool Colormap::contains(const QString &name)
+{
+    return findColormap(name) != nullptr;
+}
+
+QImage Colormap::lut(const QString &name)
+{
+    const ColormapStops *cmap = findColormap(name);
+    if (!cmap) {
+        qWarning("Colormap: unknown colormap \"%s\", using viridis", qPrintable(name));
+        cmap = &kColormaps[0];
+    }
+
+    const int lastStop = int(cmap->stops.size()) - 1;
+
+    QImage image(LutSize, 1, QImage::Format_RGBA8888);
+    for (int i = 0; i < LutSize; ++i) {
+        // Linearly interpolate between the two surrounding stops
+        qreal t = qreal(i) / (LutSize - 1) * lastStop;
+        int lo = qMin(int(t), lastStop - 1);
+        qreal f = t - lo;
+
+        QRgb a = cmap->stops[lo];
+        QRgb b = cmap->stops[lo + 1];
+        int r = qRound(qRed(a) + (qRed(b) - qRed(a)) * f);
+        int g = qRound(qGreen(a) + (qGreen(b) - qGreen(a)) * f);
+        int bl = qRound(qBlue(a) + (qBlue(b) - qBlue(a)) * f);
+
+        image.setPixelColor(i, 0, QColor(r, g, bl));
+    }
+    return image;
+}
+
+QSGTexture *Colormap::createLutTexture(QQuickWindow *window, const QString &name)
+{
+    QSGTexture *texture = window->createTextureFromImage(lut(name));
+    texture->setFiltering(QSGTexture::Linear);
+    texture->setHorizontalWrapMode(QSGTexture::ClampToEdge);
+    texture->setVerticalWrapMode(QSGTexture::ClampToEdge);
+    return texture;
+}
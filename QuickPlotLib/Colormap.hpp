@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QImage>
+#include <QString>
+#include <QStringList>
+
+class QQuickWindow;
+class QSGTexture;
+
+/*!
+    \namespace Colormap
+    \brief Built-in colormap lookup tables for scalar-field series.
+
+    Each colormap is defined by evenly spaced color stops and expanded into
+    a 256-entry lookup table. The table is uploaded as a 256x1 texture and
+    sampled by ColormapMaterial, so switching colormaps never touches the
+    series data.
+
+    Available names: "viridis", "magma", "inferno", "plasma", "gray".
+
+    \sa ColormapMaterial, ImageSeries
+*/
+namespace Colormap {
+
+/*!
+    Number of entries in a lookup table.
+*/
+constexpr int LutSize = 256;
+
+/*!
+    Returns the names of all built-in colormaps.
+*/
+QStringList names();
+
+/*!
+    Returns true if \a name is a built-in colormap.
+*/
+bool contains(const QString &name);
+
+/*!
+    Returns a LutSize x 1 lookup table image for the colormap \a name.
+    Unknown names fall back to "viridis".
+*/
+QImage lut(const QString &name);
+
+/*!
+    Uploads the lookup table of the colormap \a name as a texture for
+    \a window, set up for sampling by ColormapMaterial: linear filtering,
+    clamped at both ends. The caller owns the texture.
+
+    Must be called on the render thread, e.g. from updatePaintNode().
+*/
+QSGTexture *createLutTexture(QQuickWindow *window, const QString &name);
+
+} // namespace Colormap
@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#include "ColormapMaterial.hpp"
+
+#include <QSGMaterialShader>
+#include <QSGTexture>
+
+#include <cstddef>
+#include <cstring>
+
+namespace {
+
+// Must match the std140 uniform block in shaders/colormap.vert/.frag
+struct UniformBlock {
+    float matrix[16];
+    float opacity;
+    float vmin;
+    float vmax;
+    float logScale;
+};
+
+class ColormapMaterialShader : public QSGMaterialShader {
+public:
+    ColormapMaterialShader()
+    {
+        setShaderFileName(VertexStage, QStringLiteral(":/QuickPlotLib/shaders/colormap.vert.qsb"));
+        setShaderFileName(FragmentStage, QStringLiteral(":/QuickPlotLib/shaders/colormap.frag.qsb"));
+    }
+
+    bool updateUniformData(RenderState &state, QSGMaterial *newMaterial, QSGMaterial *) override
+    {
+        QByteArray *buffer = state.uniformData();
+        Q_ASSERT(buffer->size() >= qsizetype(sizeof(UniformBlock)));
+        char *data = buffer->data();
+
+        if (state.isMatrixDirty()) {
+            const QMatrix4x4 matrix = state.combinedMatrix();
+            std::memcpy(data + offsetof(UniformBlock, matrix), matrix.constData(), sizeof(UniformBlock::matrix));
+        }
+
+        if (state.isOpacityDirty()) {
+            const float opacity = state.opacity();
+            std::memcpy(data + offsetof(UniformBlock, opacity), &opacity, sizeof(float));
+        }
+
+        // Levels are tiny; always refresh them so a limit change never needs
+        // the data texture to be touched
+        auto *material = static_cast<ColormapMaterial *>(newMaterial);
+        const float vmin = material->vmin();
+        const float vmax = material->vmax();
+        const float logScale = material->logScale() ? 1.0f : 0.0f;
+        std::memcpy(data + offsetof(UniformBlock, vmin), &vmin, sizeof(float));
+        std::memcpy(data + offsetof(UniformBlock, vmax), &vmax, sizeof(float));
+        std::memcpy(data + offsetof(UniformBlock, logScale), &logScale, sizeof(float));
+        return true;
+    }
+
+    void updateSampledImage(RenderState &state, int binding, QSGTexture **texture,
+                            QSGMaterial *newMaterial, QSGMaterial *) override
+    {
+        auto *material = static_cast<ColormapMaterial *>(newMaterial);
+        QSGTexture *t = nullptr;
+        if (binding == 1) {
+            t = material->dataTexture();
+        } else if (binding == 2) {
+            t = material->lutTexture();
+        }
+
+        if (t) {
+            t->commitTextureOperations(state.rhi(), state.resourceUpdateBatch());
+        }
+        *texture = t;
+    }
+};
+
+} // namespace
+
+ColormapMaterial::ColormapMaterial()
+{
+    setFlag(Blending, true);
+}
+
+QSGMaterialType *ColormapMaterial::type() const
+{
+    static QSGMaterialType type;
+    return &type;
+}
+
+QSGMaterialShader *ColormapMaterial::createShader(QSGRendererInterface::RenderMode) const
+{
+    return new ColormapMaterialShader();
+}
+
+int ColormapMaterial::compare(const QSGMaterial *other) const
+{
+    auto *o = static_cast<const ColormapMaterial *>(other);
+    if (m_dataTexture != o->m_dataTexture) {
+        return m_dataTexture < o->m_dataTexture ? -1 : 1;
+    }
+    if (m_lutTexture != o->m_lutTexture) {
+        return m_lutTexture < o->m_lutTexture ? -1 : 1;
+    }
+    if (m_vmin != o->m_vmin) {
+        return m_vmin < o->m_vmin ? -1 : 1;
+    }
+    if (m_vmax != o->m_vmax) {
+        return m_vmax < o->m_vmax ? -1 : 1;
+    }
+    if (m_logScale != o->m_logScale) {
+        return m_logScale ? 1 : -1;
+    }
+    return 0;
+}
+
+void ColormapMaterial::setLevels(float vmin, float vmax)
+{
+    m_vmin = vmin;
+    m_vmax = vmax;
+}
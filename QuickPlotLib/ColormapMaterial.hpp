@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QSGMaterial>
+
+class QSGTexture;
+
+/*!
+    \class ColormapMaterial
+    \brief Scene graph material that colors scalar data through a lookup table.
+
+    The material samples a single-channel FloatTexture, normalizes each value
+    against [vmin, vmax] (linearly or logarithmically) and looks the result
+    up in a Colormap texture.
+    Changing the limits only rewrites the uniform buffer, and changing the
+    colormap only swaps the 256-texel lookup texture; the data texture is
+    never re-uploaded for either. NaN values render transparent.
+
+    The material does not own its textures.
+
+    \sa FloatTexture, Colormap
+*/
+class ColormapMaterial : public QSGMaterial {
+public:
+    ColormapMaterial();
+
+    QSGMaterialType *type() const override;
+    QSGMaterialShader *createShader(QSGRendererInterface::RenderMode renderMode) const override;
+    int compare(const QSGMaterial *other) const override;
+
+    QSGTexture *dataTexture() const { return m_dataTexture; }
+    void setDataTexture(QSGTexture *texture) { m_dataTexture = texture; }
+
+    QSGTexture *lutTexture() const { return m_lutTexture; }
+    void setLutTexture(QSGTexture *texture) { m_lutTexture = texture; }
+
+    float vmin() const { return m_vmin; }
+    float vmax() const { return m_vmax; }
+    void setLevels(float vmin, float vmax);
+
+    bool logScale() const { return m_logScale; }
+    void setLogScale(bool logScale) { m_logScale = logScale; }
+
+private:
+    QSGTexture *m_dataTexture = nullptr;
+    QSGTexture *m_lutTexture = nullptr;
+    float m_vmin = 0.0f;
+    float m_vmax = 1.0f;
+    bool m_logScale = false;
+};
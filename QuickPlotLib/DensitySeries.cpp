@@ -0,0 +1,472 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#include "DensitySeries.hpp"
+
+#include "Colormap.hpp"
+#include "ColormapMaterial.hpp"
+#include "FloatTexture.hpp"
+#include "Parallel.hpp"
+
+#include <QQuickWindow>
+#include <QSGGeometryNode>
+#include <QtMath>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace {
+
+// Points binned between two cancellation checks
+constexpr qsizetype kCancelCheckInterval = 1 << 18;
+
+// Upper bound on the private per-worker grids of one aggregation
+constexpr qsizetype kMaxScratchBytes = qsizetype(128) << 20;
+
+struct DensityJob {
+    QByteArray x;
+    QByteArray y;
+    qsizetype count = 0;
+    QRectF view;
+    QSize gridSize;
+    bool equalize = false;
+    int generation = 0;
+};
+
+struct DensityGrid {
+    QByteArray values; // float per bin, NaN for empty bins
+    qreal maxCount = 0;
+    qreal minRank = 0;
+};
+
+// Replaces counts with their position in the cumulative distribution of
+// non-empty bins, so every color of the colormap covers a similar number
+// of bins
+void equalizeGrid(float *values, qsizetype cells, DensityGrid *out)
+{
+    std::vector<float> sorted;
+    sorted.reserve(size_t(cells));
+    for (qsizetype i = 0; i < cells; ++i) {
+        if (!qIsNaN(values[i])) {
+            sorted.push_back(values[i]);
+        }
+    }
+    if (sorted.empty()) {
+        return;
+    }
+    std::sort(sorted.begin(), sorted.end());
+
+    const float total = float(sorted.size());
+    const int workers = Parallel::workerCount(cells, 1 << 16);
+    Parallel::run(workers, [&](int worker) {
+        auto [begin, end] = Parallel::sliceFor(worker, workers, cells);
+        for (qsizetype i = begin; i < end; ++i) {
+            if (!qIsNaN(values[i])) {
+                auto rank = std::upper_bound(sorted.cbegin(), sorted.cend(), values[i]) - sorted.cbegin();
+                values[i] = float(rank) / total;
+            }
+        }
+    });
+
+    auto lowest = std::upper_bound(sorted.cbegin(), sorted.cend(), sorted.front()) - sorted.cbegin();
+    out->minRank = qreal(lowest) / total;
+}
+
+// Bins the job's points into out->values. Returns false if the job was
+// superseded before it finished.
+bool aggregate(const DensityJob &job, const std::atomic<int> &generation, DensityGrid *out)
+{
+    const double *xs = reinterpret_cast<const double *>(job.x.constData());
+    const double *ys = reinterpret_cast<const double *>(job.y.constData());
+    const int columns = job.gridSize.width();
+    const int rows = job.gridSize.height();
+    const qsizetype cells = qsizetype(columns) * rows;
+
+    const double left = job.view.left();
+    const double bottom = job.view.top();
+    const double scaleX = columns / job.view.width();
+    const double scaleY = rows / job.view.height();
+
+    auto superseded = [&]() { return generation.load(std::memory_order_relaxed) != job.generation; };
+
+    // Each worker counts its slice of points into a private grid. Large grids
+    // get fewer workers so scratch memory stays bounded whatever the core
+    // count; the merge below then also reads at most kMaxScratchBytes.
+    const qsizetype gridBytes = cells * qsizetype(sizeof(quint32));
+    const int maxGrids = int(qMax<qsizetype>(1, kMaxScratchBytes / qMax<qsizetype>(1, gridBytes)));
+    const int workers = qMin(Parallel::workerCount(job.count, kCancelCheckInterval), maxGrids);
+    std::vector<std::vector<quint32>> partial(size_t(workers));
+    Parallel::run(workers, [&](int worker) {
+        std::vector<quint32> &bins = partial[size_t(worker)];
+        bins.assign(size_t(cells), 0);
+
+        auto [begin, end] = Parallel::sliceFor(worker, workers, job.count);
+        for (qsizetype i = begin; i < end;) {
+            if (superseded()) {
+                return;
+            }
+            const qsizetype blockEnd = qMin(end, i + kCancelCheckInterval);
+            for (; i < blockEnd; ++i) {
+                const double fx = (xs[i] - left) * scaleX;
+                const double fy = (ys[i] - bottom) * scaleY;
+                // Written so NaN coordinates fail the test and are skipped
+                if (fx >= 0 && fx < columns && fy >= 0 && fy < rows) {
+                    ++bins[size_t(fy) * size_t(columns) + size_t(fx)];
+                }
+            }
+        }
+    });
+
+    if (superseded()) {
+        return false;
+    }
+
+    // Merge the partial grids, each worker summing a band of bins
+    out->values = QByteArray(cells * qsizetype(sizeof(float)), Qt::Uninitialized);
+    float *values = reinterpret_cast<float *>(out->values.data());
+    const int mergeWorkers = Parallel::workerCount(cells, 1 << 16);
+    std::vector<quint32> maxCounts(size_t(mergeWorkers), 0);
+    Parallel::run(mergeWorkers, [&](int worker) {
+        auto [begin, end] = Parallel::sliceFor(worker, mergeWorkers, cells);
+        quint32 maxCount = 0;
+        for (qsizetype i = begin; i < end; ++i) {
+            quint32 sum = 0;
+            for (const std::vector<quint32> &bins : partial) {
+                sum += bins[size_t(i)];
+            }
+            values[i] = sum ? float(sum) : std::numeric_limits<float>::quiet_NaN();
+            maxCount = qMax(maxCount, sum);
+        }
+        maxCounts[size_t(worker)] = maxCount;
+    });
+    out->maxCount = *std::max_element(maxCounts.cbegin(), maxCounts.cend());
+
+    if (job.equalize) {
+        partial.clear();
+        equalizeGrid(values, cells, out);
+    }
+
+    return !superseded();
+}
+
+class DensityNode : public QSGGeometryNode {
+public:
+    DensityNode()
+        : quad(QSGGeometry::defaultAttributes_TexturedPoint2D(), 4)
+    {
+        quad.setDrawingMode(QSGGeometry::DrawTriangleStrip);
+        setGeometry(&quad);
+        material.setDataTexture(&texture);
+        setMaterial(&material);
+    }
+
+    ~DensityNode() override { delete lut; }
+
+    QSGGeometry quad;
+    FloatTexture texture;
+    ColormapMaterial material;
+    QSGTexture *lut = nullptr;
+};
+
+} // namespace
+
+DensitySeries::DensitySeries(QQuickItem *parent)
+    : Series(parent)
+{
+    setFlag(ItemHasContents, true);
+    // Binning parallelizes internally; one job at a time is enough
+    m_pool.setMaxThreadCount(1);
+    m_indexPool.setMaxThreadCount(1);
+    connect(this, &Series::viewRectChanged, this, &DensitySeries::scheduleAggregation);
+}
+
+DensitySeries::~DensitySeries()
+{
+    // Cancel and wait so no job outlives the item it reports to
+    ++m_generation;
+    ++m_indexGeneration;
+    m_pool.clear();
+    m_indexPool.clear();
+    m_pool.waitForDone();
+    m_indexPool.waitForDone();
+}
+
+void DensitySeries::setNormalization(Normalization normalization)
+{
+    if (m_normalization == normalization) {
+        return;
+    }
+    // Linear and Log only differ in the shader; EqHist needs new bin values
+    const bool regrid = m_normalization == EqHist || normalization == EqHist;
+    m_normalization = normalization;
+    emit normalizationChanged();
+    if (regrid) {
+        scheduleAggregation();
+    }
+    update();
+}
+
+void DensitySeries::setColormap(const QString &colormap)
+{
+    if (m_colormap == colormap) {
+        return;
+    }
+    if (!Colormap::contains(colormap)) {
+        qWarning("DensitySeries: unknown colormap \"%s\"", qPrintable(colormap));
+        return;
+    }
+    m_colormap = colormap;
+    m_colormapDirty = true;
+    emit colormapChanged();
+    update();
+}
+
+void DensitySeries::setBinSize(int size)
+{
+    size = qMax(1, size);
+    if (m_binSize == size) {
+        return;
+    }
+    m_binSize = size;
+    emit binSizeChanged();
+    scheduleAggregation();
+}
+
+void DensitySeries::setData(const QByteArray &x, const QByteArray &y)
+{
+    if (x.size() != y.size() || x.size() % qsizetype(sizeof(double)) != 0) {
+        qWarning("DensitySeries::setData: x and y must be float64 arrays of equal length");
+        return;
+    }
+    m_x = x;
+    m_y = y;
+    m_count = x.size() / qsizetype(sizeof(double));
+    emit dataChanged();
+    scheduleAggregation();
+    startIndexing();
+}
+
+void DensitySeries::clear()
+{
+    if (m_count == 0) {
+        return;
+    }
+    m_x.clear();
+    m_y.clear();
+    m_count = 0;
+    emit dataChanged();
+    scheduleAggregation();
+    startIndexing();
+}
+
+void DensitySeries::geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    Series::geometryChange(newGeometry, oldGeometry);
+    if (newGeometry.size() != oldGeometry.size()) {
+        scheduleAggregation();
+    }
+}
+
+void DensitySeries::itemChange(ItemChange change, const ItemChangeData &value)
+{
+    Series::itemChange(change, value);
+
+    // The grid resolution follows the window's device pixel ratio
+    if (change == ItemDevicePixelRatioHasChanged || change == ItemSceneChange) {
+        scheduleAggregation();
+    }
+}
+
+void DensitySeries::scheduleAggregation()
+{
+    // Coalesce all changes made within a frame into one job
+    m_aggregationPending = true;
+    polish();
+    update();
+}
+
+void DensitySeries::updatePolish()
+{
+    if (m_aggregationPending) {
+        m_aggregationPending = false;
+        startAggregation();
+    }
+}
+
+void DensitySeries::setBusy(bool busy)
+{
+    if (m_busy == busy) {
+        return;
+    }
+    m_busy = busy;
+    emit busyChanged();
+}
+
+void DensitySeries::startAggregation()
+{
+    // Supersede whatever is queued or running
+    const int generation = ++m_generation;
+    m_pool.clear();
+
+    const qreal dpr = window() ? window()->effectiveDevicePixelRatio() : 1.0;
+    const QSize gridSize(qCeil(width() * dpr / m_binSize), qCeil(height() * dpr / m_binSize));
+    const QRectF view = viewRect();
+
+    if (m_count == 0 || gridSize.isEmpty() || view.width() <= 0 || view.height() <= 0) {
+        m_grid.clear();
+        m_gridSize = QSize();
+        m_gridMaxCount = 0;
+        m_gridDirty = true;
+        setBusy(false);
+        emit gridChanged();
+        update();
+        return;
+    }
+
+    DensityJob job;
+    job.x = m_x;
+    job.y = m_y;
+    job.count = m_count;
+    job.view = view;
+    job.gridSize = gridSize;
+    job.equalize = m_normalization == EqHist;
+    job.generation = generation;
+
+    setBusy(true);
+    m_pool.start([this, job]() {
+        DensityGrid grid;
+        if (!aggregate(job, m_generation, &grid)) {
+            return;
+        }
+        QMetaObject::invokeMethod(this, [this, job, grid]() {
+            if (job.generation != m_generation.load()) {
+                return;
+            }
+            m_grid = grid.values;
+            m_gridSize = job.gridSize;
+            m_gridView = job.view;
+            m_gridMaxCount = grid.maxCount;
+            m_gridMinRank = grid.minRank;
+            m_gridEqualized = job.equalize;
+            m_gridDirty = true;
+            setBusy(false);
+            emit gridChanged();
+            update();
+        }, Qt::QueuedConnection);
+    });
+}
+
+void DensitySeries::startIndexing()
+{
+    const int generation = ++m_indexGeneration;
+    m_indexPool.clear();
+
+    if (m_index) {
+        m_index.reset();
+        emit indexedChanged();
+    }
+    if (m_count == 0) {
+        return;
+    }
+
+    m_indexPool.start([this, x = m_x, y = m_y, generation]() {
+        auto index = std::make_shared<PointIndex>();
+        auto superseded = [this, generation]() { return m_indexGeneration.load(std::memory_order_relaxed) != generation; };
+        if (!index->build(x, y, superseded)) {
+            return;
+        }
+        QMetaObject::invokeMethod(this, [this, index, generation]() {
+            if (generation != m_indexGeneration.load()) {
+                return;
+            }
+            m_index = index;
+            emit indexedChanged();
+        }, Qt::QueuedConnection);
+    });
+}
+
+int DensitySeries::nearestPoint(qreal x, qreal y, qreal radiusPx) const
+{
+    if (!m_index || width() <= 0 || height() <= 0) {
+        return -1;
+    }
+
+    // Convert the pixel radius to data units on each axis so the search is
+    // circular on screen
+    const QPointF center = mapToData(x, y);
+    const qreal rx = radiusPx * qAbs(viewRect().width()) / width();
+    const qreal ry = radiusPx * qAbs(viewRect().height()) / height();
+    return int(m_index->nearest(center.x(), center.y(), rx, ry));
+}
+
+QList<int> DensitySeries::pointsInRect(const QRectF &rect) const
+{
+    if (!m_index || width() <= 0 || height() <= 0) {
+        return {};
+    }
+
+    const QPointF a = mapToData(rect.left(), rect.top());
+    const QPointF b = mapToData(rect.right(), rect.bottom());
+    return m_index->pointsInRect(QRectF(a, b).normalized());
+}
+
+QPointF DensitySeries::pointAt(int index) const
+{
+    if (index < 0 || index >= m_count) {
+        return QPointF();
+    }
+    return QPointF(reinterpret_cast<const double *>(m_x.constData())[index],
+                   reinterpret_cast<const double *>(m_y.constData())[index]);
+}
+
+QSGNode *DensitySeries::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *)
+{
+    if (m_grid.isEmpty() || width() <= 0 || height() <= 0 || !window()) {
+        delete oldNode;
+        return nullptr;
+    }
+
+    auto *node = static_cast<DensityNode *>(oldNode);
+    if (!node) {
+        node = new DensityNode();
+        m_colormapDirty = true;
+        m_gridDirty = true;
+    }
+
+    if (m_colormapDirty) {
+        delete node->lut;
+        node->lut = Colormap::createLutTexture(window(), m_colormap);
+        node->material.setLutTexture(node->lut);
+        m_colormapDirty = false;
+    }
+
+    if (m_gridDirty) {
+        node->texture.setTextureSize(m_gridSize);
+        node->texture.uploadRegion(m_grid, 0, m_gridSize.width() * int(sizeof(float)), QRect(QPoint(0, 0), m_gridSize));
+        m_gridDirty = false;
+    }
+
+    // A grid computed for EqHist already holds ranks in (0, 1]. Otherwise the
+    // counts are shaded linearly or logarithmically without recomputing.
+    if (m_gridEqualized) {
+        node->material.setLevels(float(m_gridMinRank), 1.0f);
+        node->material.setLogScale(false);
+    } else if (m_normalization == Log) {
+        node->material.setLevels(1.0f, float(m_gridMaxCount));
+        node->material.setLogScale(true);
+    } else {
+        node->material.setLevels(0.0f, float(m_gridMaxCount));
+        node->material.setLogScale(false);
+    }
+    node->markDirty(QSGNode::DirtyMaterial);
+
+    // Stretch the last finished grid onto the current view; row 0 is the
+    // bottom of the grid's view
+    const QPointF topLeft = mapFromData(m_gridView.left(), m_gridView.bottom());
+    const QPointF bottomRight = mapFromData(m_gridView.right(), m_gridView.top());
+    QSGGeometry::updateTexturedRectGeometry(&node->quad, QRectF(topLeft, bottomRight), QRectF(0, 1, 1, -1));
+    node->markDirty(QSGNode::DirtyGeometry);
+
+    return node;
+}
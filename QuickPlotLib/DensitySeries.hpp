@@ -0,0 +1,197 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "PointIndex.hpp"
+#include "Series.hpp"
+
+#include <QByteArray>
+#include <QSize>
+#include <QThreadPool>
+#include <QtQml/qqmlregistration.h>
+
+#include <atomic>
+#include <memory>
+
+/*!
+    \qmltype DensitySeries
+    \inqmlmodule QuickPlotLib
+    \inherits Series
+    \brief Shows massive scatter data as a colormapped 2D point-density image.
+
+    Instead of drawing one marker per point, DensitySeries counts the points
+    falling into each bin of a screen-resolution grid covering viewRect and
+    shades the counts through a colormap. This keeps 20-100M point scatter
+    plots interactive.
+
+    Binning runs in the background on all cores: each worker counts its slice
+    of the points into a private grid and the partial grids are merged at the
+    end. The grid is recomputed only when the data, viewRect, item size,
+    binSize or the switch to/from EqHist normalization requires it. Requests
+    arriving during a continuous zoom cancel the computation in flight, and
+    the last finished grid is stretched to the current view until the new one
+    is ready.
+
+    Coordinates are float64 arrays passed as QByteArray. From Python:
+    \code
+    series.setData(x.astype(numpy.float64).tobytes(), y.astype(numpy.float64).tobytes())
+    \endcode
+
+    Empty bins are transparent.
+
+    For hover and selection, a PointIndex is built in the background whenever
+    the data changes. nearestPoint() and pointsInRect() query it without
+    scanning the points; they return no result until the index is ready
+    (see indexed).
+
+    \sa Series, ImageSeries
+*/
+class DensitySeries : public Series {
+    Q_OBJECT
+    QML_ELEMENT
+
+    /*!
+        How bin counts map to the colormap.
+        \value DensitySeries.Linear Proportional to the count
+        \value DensitySeries.Log Proportional to log(count)
+        \value DensitySeries.EqHist Histogram-equalized: each color covers
+               roughly the same number of non-empty bins
+    */
+    Q_PROPERTY(Normalization normalization READ normalization WRITE setNormalization NOTIFY normalizationChanged)
+
+    /*!
+        The colormap name (e.g., "viridis", "magma", "gray").
+    */
+    Q_PROPERTY(QString colormap READ colormap WRITE setColormap NOTIFY colormapChanged)
+
+    /*!
+        Edge length of a bin in device pixels. Defaults to 1 (one bin per pixel).
+    */
+    Q_PROPERTY(int binSize READ binSize WRITE setBinSize NOTIFY binSizeChanged)
+
+    /*!
+        Number of points held. Read-only.
+    */
+    Q_PROPERTY(qint64 pointCount READ pointCount NOTIFY dataChanged)
+
+    /*!
+        The highest bin count of the displayed grid. Read-only.
+    */
+    Q_PROPERTY(qreal maxCount READ maxCount NOTIFY gridChanged)
+
+    /*!
+        True while a grid is being computed in the background.
+    */
+    Q_PROPERTY(bool busy READ busy NOTIFY busyChanged)
+
+    /*!
+        True once the picking index for the current data has been built.
+    */
+    Q_PROPERTY(bool indexed READ indexed NOTIFY indexedChanged)
+
+public:
+    enum Normalization {
+        Linear,
+        Log,
+        EqHist
+    };
+    Q_ENUM(Normalization)
+
+    explicit DensitySeries(QQuickItem *parent = nullptr);
+    ~DensitySeries() override;
+
+    Normalization normalization() const { return m_normalization; }
+    void setNormalization(Normalization normalization);
+
+    QString colormap() const { return m_colormap; }
+    void setColormap(const QString &colormap);
+
+    int binSize() const { return m_binSize; }
+    void setBinSize(int size);
+
+    qint64 pointCount() const { return m_count; }
+    qreal maxCount() const { return m_gridMaxCount; }
+    bool busy() const { return m_busy; }
+    bool indexed() const { return m_index != nullptr; }
+
+    /*!
+        Replaces the points with \a x and \a y, two float64 arrays of equal
+        length.
+    */
+    Q_INVOKABLE void setData(const QByteArray &x, const QByteArray &y);
+
+    /*!
+        Removes all points.
+    */
+    Q_INVOKABLE void clear();
+
+    /*!
+        Returns the index of the point nearest to item position (\a x, \a y)
+        within \a radiusPx pixels, or -1 if there is none.
+    */
+    Q_INVOKABLE int nearestPoint(qreal x, qreal y, qreal radiusPx) const;
+
+    /*!
+        Returns the indices of all points inside \a rect, given in item
+        pixels (e.g. a rubber-band selection), in no particular order.
+    */
+    Q_INVOKABLE QList<int> pointsInRect(const QRectF &rect) const;
+
+    /*!
+        Returns the data coordinates of point \a index.
+    */
+    Q_INVOKABLE QPointF pointAt(int index) const;
+
+signals:
+    void normalizationChanged();
+    void colormapChanged();
+    void binSizeChanged();
+    void dataChanged();
+    void gridChanged();
+    void busyChanged();
+    void indexedChanged();
+
+protected:
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData) override;
+    void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    void itemChange(ItemChange change, const ItemChangeData &value) override;
+    void updatePolish() override;
+
+private:
+    void scheduleAggregation();
+    void startAggregation();
+    void setBusy(bool busy);
+    void startIndexing();
+
+    QByteArray m_x;
+    QByteArray m_y;
+    qint64 m_count = 0;
+
+    Normalization m_normalization = Linear;
+    QString m_colormap = "viridis";
+    int m_binSize = 1;
+
+    // Latest finished grid and the view it was computed for
+    QByteArray m_grid;
+    QSize m_gridSize;
+    QRectF m_gridView;
+    qreal m_gridMaxCount = 0;
+    qreal m_gridMinRank = 0;
+    bool m_gridEqualized = false;
+
+    // Background aggregation. A job whose generation no longer matches
+    // m_generation has been superseded and stops at its next check.
+    QThreadPool m_pool;
+    std::atomic<int> m_generation { 0 };
+    bool m_aggregationPending = false;
+    bool m_busy = false;
+
+    // Picking index for the current data, replaced wholesale when rebuilt
+    std::shared_ptr<const PointIndex> m_index;
+    QThreadPool m_indexPool;
+    std::atomic<int> m_indexGeneration { 0 };
+
+    bool m_gridDirty = false;
+    bool m_colormapDirty = true;
+};
@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#include "FloatTexture.hpp"
+
+#include <rhi/qrhi.h>
+
+FloatTexture::FloatTexture()
+{
+    setFiltering(QSGTexture::Nearest);
+    setMipmapFiltering(QSGTexture::None);
+    setHorizontalWrapMode(QSGTexture::ClampToEdge);
+    setVerticalWrapMode(QSGTexture::ClampToEdge);
+}
+
+FloatTexture::~FloatTexture()
+{
+    if (m_texture) {
+        m_texture->deleteLater();
+    }
+}
+
+qint64 FloatTexture::comparisonKey() const
+{
+    return qint64(reinterpret_cast<quintptr>(this));
+}
+
+void FloatTexture::setTextureSize(const QSize &size)
+{
+    if (m_size == size) {
+        return;
+    }
+    m_size = size;
+    // Anything recorded for the old size no longer fits
+    m_pending.clear();
+}
+
+void FloatTexture::uploadRegion(const QByteArray &source, qsizetype offset, int stride, const QRect &target)
+{
+    QRect clipped = target.intersected(QRect(QPoint(0, 0), m_size));
+    if (clipped != target || target.isEmpty()) {
+        return;
+    }
+    m_pending.append({ source, offset, stride, target });
+}
+
+void FloatTexture::commitTextureOperations(QRhi *rhi, QRhiResourceUpdateBatch *resourceUpdates)
+{
+    m_inFlight.clear();
+
+    if (m_size.isEmpty()) {
+        return;
+    }
+
+    if (!m_texture || m_texture->pixelSize() != m_size) {
+        if (m_texture) {
+            m_texture->deleteLater();
+        }
+        m_texture = rhi->newTexture(QRhiTexture::R32F, m_size);
+        if (!m_texture->create()) {
+            qWarning("FloatTexture: failed to create %dx%d R32F texture", m_size.width(), m_size.height());
+            delete m_texture;
+            m_texture = nullptr;
+            m_pending.clear();
+            return;
+        }
+    }
+
+    if (m_pending.isEmpty()) {
+        return;
+    }
+
+    QList<QRhiTextureUploadEntry> entries;
+    entries.reserve(m_pending.size());
+    for (const PendingUpload &upload : std::as_const(m_pending)) {
+        const int rowBytes = upload.target.width() * int(sizeof(float));
+        const qsizetype length = qsizetype(upload.target.height() - 1) * upload.stride + rowBytes;
+
+        QRhiTextureSubresourceUploadDescription desc(
+            QByteArray::fromRawData(upload.source.constData() + upload.offset, length));
+        desc.setDestinationTopLeft(upload.target.topLeft());
+        desc.setSourceSize(upload.target.size());
+        desc.setDataStride(quint32(upload.stride));
+        entries.append(QRhiTextureUploadEntry(0, 0, desc));
+    }
+
+    QRhiTextureUploadDescription description;
+    description.setEntries(entries.cbegin(), entries.cend());
+    resourceUpdates->uploadTexture(m_texture, description);
+
+    m_inFlight = std::move(m_pending);
+    m_pending.clear();
+}
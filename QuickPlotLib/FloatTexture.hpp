@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QByteArray>
+#include <QList>
+#include <QRect>
+#include <QSGTexture>
+
+class QRhiTexture;
+
+/*!
+    \class FloatTexture
+    \brief Single-channel 32-bit float texture with partial uploads.
+
+    FloatTexture keeps scalar data on the GPU as an R32F texture so that
+    value-to-color mapping can happen in a shader. Uploads are recorded in
+    updatePaintNode(), which runs on the render thread while the GUI thread
+    is blocked, and committed when the material binds the texture.
+
+    Uploads reference the caller's QByteArray directly (implicitly shared),
+    so no intermediate copy is made on the CPU side. Source rows may be
+    strided, which lets a tile be uploaded straight out of a larger image.
+
+    R32F is not filterable on every backend, so the texture always samples
+    with nearest filtering.
+
+    \sa ColormapMaterial
+*/
+class FloatTexture : public QSGTexture {
+    Q_OBJECT
+
+public:
+    FloatTexture();
+    ~FloatTexture() override;
+
+    qint64 comparisonKey() const override;
+    QRhiTexture *rhiTexture() const override { return m_texture; }
+    QSize textureSize() const override { return m_size; }
+    bool hasAlphaChannel() const override { return false; }
+    bool hasMipmaps() const override { return false; }
+
+    void commitTextureOperations(QRhi *rhi, QRhiResourceUpdateBatch *resourceUpdates) override;
+
+    /*!
+        Sets the texture size in texels. A size change reallocates the
+        texture on the next commit and leaves its contents undefined until
+        new data is uploaded.
+    */
+    void setTextureSize(const QSize &size);
+
+    /*!
+        Schedules an upload of \a target (in texels) from \a source.
+        \a offset is the byte offset of the first float of the region and
+        \a stride the number of bytes between consecutive source rows.
+    */
+    void uploadRegion(const QByteArray &source, qsizetype offset, int stride, const QRect &target);
+
+private:
+    struct PendingUpload {
+        QByteArray source;
+        qsizetype offset = 0;
+        int stride = 0;
+        QRect target;
+    };
+
+    QSize m_size;
+    QRhiTexture *m_texture = nullptr;
+
+    // Uploads recorded since the last commit
+    QList<PendingUpload> m_pending;
+
+    // Uploads handed to the last resource batch. The batch only references
+    // the bytes, so the sources are kept alive until the next commit.
+    QList<PendingUpload> m_inFlight;
+};
@@ -2,10 +2,10 @@
 // SPDX-License-Identifier: MIT
 
 #include "Glyph.hpp"
+#include "GlyphRunCache.hpp"
 
-#include <QPainter>
 #include <QFontMetricsF>
-#include <QSGSimpleTextureNode>
+#include <QSGTextNode>
 #include <QQuickWindow>
 
 Glyph::Glyph(QQuickItem *parent)
@@ -23,11 +23,8 @@ void Glyph::setText(const QString &text)
         return;
     }
     m_text = text;
-    updateMetrics();
-    m_imageDirty = true;
-    m_textureDirty = true;
+    invalidateMetrics();
     emit textChanged();
-    update();
 }
 
 void Glyph::setColor(const QColor &color)
@@ -36,8 +33,7 @@ void Glyph::setColor(const QColor &color)
         return;
     }
     m_color = color;
-    m_imageDirty = true;
-    m_textureDirty = true;
+    m_nodeDirty = true;
     emit colorChanged();
     update();
 }
@@ -48,11 +44,8 @@ void Glyph::setFontFamily(const QString &family)
         return;
     }
     m_fontFamily = family;
-    updateMetrics();
-    m_imageDirty = true;
-    m_textureDirty = true;
+    invalidateMetrics();
     emit fontChanged();
-    update();
 }
 
 void Glyph::setPixelSize(int size)
@@ -61,11 +54,8 @@ void Glyph::setPixelSize(int size)
         return;
     }
     m_pixelSize = size;
-    updateMetrics();
-    m_imageDirty = true;
-    m_textureDirty = true;
+    invalidateMetrics();
     emit fontChanged();
-    update();
 }
 
 void Glyph::setFontWeight(int weight)
@@ -74,10 +64,26 @@ void Glyph::setFontWeight(int weight)
         return;
     }
     m_fontWeight = weight;
-    updateMetrics();
-    m_imageDirty = true;
-    m_textureDirty = true;
+    invalidateMetrics();
     emit fontChanged();
+}
+
+void Glyph::invalidateMetrics()
+{
+    // Defer to updatePolish() so several changes in a row shape only once
+    m_metricsDirty = true;
+    polish();
+}
+
+void Glyph::updatePolish()
+{
+    if (!m_metricsDirty) {
+        return;
+    }
+    m_metricsDirty = false;
+    updateMetrics();
+    m_nodeDirty = true;
+    emit metricsChanged();
     update();
 }
 
@@ -93,30 +99,34 @@ void Glyph::updateMetrics()
     m_ascent = fm.ascent();
     m_descent = fm.descent();
 
-    // Calculate logical text width (needed for comparison)
-    m_textWidth = fm.horizontalAdvance(m_text);
+    // Shape once (or reuse a label shaped earlier); the same runs are drawn
+    m_shaped = GlyphRunCache::shape(font, m_text);
 
     // Calculate ink bounding rects
     // Use TWO different rects for optimal results:
-    // - boundingRect() for HORIZONTAL: consistent width metrics (keeps "10.00" fix)
-    // - tightBoundingRect() for VERTICAL: true ink height (no extra ascent/descent space)
-    if (!m_text.isEmpty()) {
-        QRectF horzRect = fm.boundingRect(m_text);       // For horizontal metrics
-        QRectF vertRect = fm.tightBoundingRect(m_text); // For vertical metrics
-        
+    // - boundingRect for HORIZONTAL: consistent width metrics (keeps "10.00" fix)
+    // - tightBoundingRect for VERTICAL: true ink height (no extra ascent/descent space)
+    if (m_shaped) {
+        const QRectF &horzRect = m_shaped->boundingRect;      // For horizontal metrics
+        const QRectF &vertRect = m_shaped->tightBoundingRect; // For vertical metrics
+
+        // Logical text width (needed for comparison)
+        m_textWidth = m_shaped->advance;
+
         // Store raw offsets for use in rendering (to shift ink to origin)
         m_rawInkLeft = horzRect.left();
         m_rawInkTop = vertRect.top();  // Use tight rect for vertical
-        
+
         // Get the actual ink dimensions
         m_inkWidth = horzRect.width();   // Use boundingRect for consistent horizontal
         m_inkHeight = vertRect.height(); // Use tightBoundingRect for true vertical ink
-        
+
         // NORMALIZE: After rendering, ink will start at (0,0)
         // So expose inkLeft=0, inkRight=inkWidth
         m_inkLeft = 0;
         m_inkRight = m_inkWidth;
     } else {
+        m_textWidth = 0;
         m_rawInkLeft = 0;
         m_rawInkTop = 0;
         m_inkLeft = 0;
@@ -131,87 +141,35 @@ void Glyph::updateMetrics()
     setImplicitHeight(qCeil(m_inkHeight));
 }
 
-void Glyph::renderToImage()
-{
-    if (!m_imageDirty) {
-        return;
-    }
-
-    // Use ink dimensions for image - this is the actual visible pixel size
-    int imgWidth = qCeil(m_inkWidth);
-    int imgHeight = qCeil(m_inkHeight);
-
-    if (imgWidth <= 0 || imgHeight <= 0 || m_text.isEmpty()) {
-        m_renderedImage = QImage();
-        m_imageDirty = false;
-        return;
-    }
-
-    // Create image with transparent background
-    m_renderedImage = QImage(imgWidth, imgHeight, QImage::Format_ARGB32_Premultiplied);
-    m_renderedImage.fill(Qt::transparent);
-
-    QPainter painter(&m_renderedImage);
-    painter.setRenderHint(QPainter::Antialiasing, true);
-    painter.setRenderHint(QPainter::TextAntialiasing, true);
-
-    QFont font(m_fontFamily);
-    font.setPixelSize(m_pixelSize);
-    font.setWeight(static_cast<QFont::Weight>(m_fontWeight));
-
-    painter.setFont(font);
-    painter.setPen(m_color);
-
-    // Draw text shifted by (-rawInkLeft, -rawInkTop) so ink pixels start at (0,0)
-    // This normalizes the ink region to always begin at the top-left of the image
-    //
-    // Horizontal: if boundingRect().left() = -2.3, we draw at x = +2.3
-    // Vertical: if boundingRect().top() = -10 (above baseline), we draw baseline at y = +10
-    //           which is exactly -rawInkTop (since rawInkTop is negative)
-    painter.drawText(QPointF(-m_rawInkLeft, -m_rawInkTop), m_text);
-
-    painter.end();
-
-    m_imageDirty = false;
-}
-
 QSGNode *Glyph::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *)
 {
-    if (m_text.isEmpty() || width() <= 0 || height() <= 0) {
+    if (!m_shaped || width() <= 0 || height() <= 0 || !window()) {
         delete oldNode;
         return nullptr;
     }
 
-    // Render text to image if dirty
-    renderToImage();
-
-    if (m_renderedImage.isNull()) {
-        delete oldNode;
-        return nullptr;
-    }
-
-    QSGSimpleTextureNode *node = static_cast<QSGSimpleTextureNode *>(oldNode);
+    QSGTextNode *node = static_cast<QSGTextNode *>(oldNode);
 
     if (!node) {
-        node = new QSGSimpleTextureNode();
-        node->setFiltering(QSGTexture::Linear);
-        m_textureDirty = true;
+        node = window()->createTextNode();
+        node->setRenderType(QSGTextNode::NativeRendering);
+        m_nodeDirty = true;
     }
 
-    if (m_textureDirty && window()) {
-        // Delete old texture if exists
-        if (node->texture()) {
-            delete node->texture();
-        }
-
-        // Create new texture from rendered image
-        QSGTexture *texture = window()->createTextureFromImage(m_renderedImage);
-        node->setTexture(texture);
-        node->setOwnsTexture(true);
-        m_textureDirty = false;
+    if (m_nodeDirty) {
+        node->clear();
+        node->setColor(m_color);
+
+        // Place the layout so ink pixels start at (0,0): shift by the raw ink
+        // offsets, which are baseline-relative, and by the layout's baseline.
+        //
+        // Horizontal: if boundingRect.left() = -2.3, the origin goes to x = +2.3
+        // Vertical: if tightBoundingRect.top() = -10 (above baseline), the
+        //           baseline goes to y = +10, so the layout top is at 10 - baseline
+        node->addTextLayout(QPointF(-m_rawInkLeft, -m_rawInkTop - m_shaped->baseline),
+                            m_shaped->layout.get());
+        m_nodeDirty = false;
     }
 
-    node->setRect(boundingRect());
-
     return node;
 }
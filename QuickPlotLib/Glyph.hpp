@@ -6,10 +6,11 @@
 #include <QQuickItem>
 #include <QColor>
 #include <QFont>
-#include <QImage>
 #include <QtQml/qqmlregistration.h>
 
-class QSGTexture;
+#include <memory>
+
+struct ShapedText;
 
 /*!
     \qmltype Glyph
@@ -25,7 +26,14 @@ class QSGTexture;
     - Width: horizontal advance of the text
     - Height: ascent + descent (no leading/padding)
 
-    Rendering uses the Qt Quick Scene Graph with cached textures for GPU acceleration.
+    The text is shaped once per (font, string) through GlyphRunCache; the
+    same glyph runs provide the metrics and are drawn as scene graph glyph
+    nodes from the shared glyph atlas. Identical labels share one shaping
+    result, and changing the color does not reshape or rasterize anything.
+
+    Changes to text and font are resolved once per frame, in updatePolish():
+    setting text, fontFamily, pixelSize and fontWeight together computes the
+    metrics and implicit size once and emits a single metricsChanged().
 
     \sa TickLabel, Axis
 */
@@ -62,39 +70,39 @@ class Glyph : public QQuickItem {
         The exact ascent of the font (distance from baseline to top of glyphs).
         Read-only, computed from font metrics.
     */
-    Q_PROPERTY(qreal ascent READ ascent NOTIFY fontChanged)
+    Q_PROPERTY(qreal ascent READ ascent NOTIFY metricsChanged)
 
     /*!
         The exact descent of the font (distance from baseline to bottom of glyphs).
         Read-only, computed from font metrics.
     */
-    Q_PROPERTY(qreal descent READ descent NOTIFY fontChanged)
+    Q_PROPERTY(qreal descent READ descent NOTIFY metricsChanged)
 
     /*!
         The left edge of actual ink pixels, relative to item x=0.
         Can be negative if glyphs extend left of the origin.
         Use for pixel-perfect positioning based on visual ink, not logical bounds.
     */
-    Q_PROPERTY(qreal inkLeft READ inkLeft NOTIFY textChanged)
+    Q_PROPERTY(qreal inkLeft READ inkLeft NOTIFY metricsChanged)
 
     /*!
         The right edge of actual ink pixels, relative to item x=0.
         Equal to inkLeft + inkWidth.
     */
-    Q_PROPERTY(qreal inkRight READ inkRight NOTIFY textChanged)
+    Q_PROPERTY(qreal inkRight READ inkRight NOTIFY metricsChanged)
 
     /*!
         The width of actual ink pixels (visual width of rendered text).
         Use for pixel-perfect positioning based on visual ink, not logical bounds.
     */
-    Q_PROPERTY(qreal inkWidth READ inkWidth NOTIFY textChanged)
+    Q_PROPERTY(qreal inkWidth READ inkWidth NOTIFY metricsChanged)
 
     /*!
         The height of actual ink pixels (visual height of rendered text).
         This is the tight vertical bound - excludes empty space for descenders
         if the text has none.
     */
-    Q_PROPERTY(qreal inkHeight READ inkHeight NOTIFY textChanged)
+    Q_PROPERTY(qreal inkHeight READ inkHeight NOTIFY metricsChanged)
 
 public:
     explicit Glyph(QQuickItem *parent = nullptr);
@@ -126,13 +134,15 @@ signals:
     void textChanged();
     void colorChanged();
     void fontChanged();
+    void metricsChanged();
 
 protected:
     QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData) override;
+    void updatePolish() override;
 
 private:
+    void invalidateMetrics();
     void updateMetrics();
-    void renderToImage();
 
     QString m_text;
     QColor m_color = Qt::black;
@@ -140,6 +150,9 @@ private:
     int m_pixelSize = 12;
     int m_fontWeight = QFont::Normal;
 
+    // Set by text/font setters, resolved in updatePolish()
+    bool m_metricsDirty = false;
+
     // Cached metrics
     qreal m_ascent = 0;
     qreal m_descent = 0;
@@ -157,8 +170,7 @@ private:
     qreal m_rawInkLeft = 0;
     qreal m_rawInkTop = 0;
 
-    // Cached rendered image
-    QImage m_renderedImage;
-    bool m_imageDirty = true;
-    bool m_textureDirty = true;
+    // Shaped text from GlyphRunCache, null when the text is empty
+    std::shared_ptr<const ShapedText> m_shaped;
+    bool m_nodeDirty = true;
 };
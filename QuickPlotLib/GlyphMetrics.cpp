@@ -2,11 +2,23 @@
 // SPDX-License-Identifier: MIT
 
 #include "GlyphMetrics.hpp"
+#include "GlyphRunCache.hpp"
 
 #include <QFont>
 #include <QFontMetricsF>
 #include <QtMath>
 
+struct GlyphMetrics::FontCache {
+    explicit FontCache(const QFont &font)
+        : font(font)
+        , metrics(font)
+    {
+    }
+
+    QFont font;
+    QFontMetricsF metrics;
+};
+
 // Helper to calculate total width including bearing compensation
 // This matches the Glyph component's width calculation exactly
 static qreal calculateGlyphWidth(const QFontMetricsF &fm, const QString &text)
@@ -39,45 +51,54 @@ GlyphMetrics::GlyphMetrics(QObject *parent)
 {
 }
 
+GlyphMetrics::FontCache &GlyphMetrics::fontCache(const QString &fontFamily, int pixelSize) const
+{
+    const QString key = fontFamily + QLatin1Char('/') + QString::number(pixelSize);
+    std::shared_ptr<FontCache> &cache = m_fontCaches[key];
+    if (!cache) {
+        QFont font(fontFamily);
+        font.setPixelSize(pixelSize);
+        cache = std::make_shared<FontCache>(font);
+    }
+    return *cache;
+}
+
+QRectF GlyphMetrics::inkBounds(FontCache &cache, const QString &text) const
+{
+    // Shared with Glyph, so a label measured here is not shaped again when drawn
+    std::shared_ptr<const ShapedText> shaped = GlyphRunCache::shape(cache.font, text);
+    return shaped ? shaped->boundingRect : QRectF();
+}
+
 qreal GlyphMetrics::textWidth(const QString &text, const QString &fontFamily, int pixelSize) const
 {
-    QFont font(fontFamily);
-    font.setPixelSize(pixelSize);
-    QFontMetricsF fm(font);
+    const QFontMetricsF &fm = fontCache(fontFamily, pixelSize).metrics;
     // Use helper that includes bearing compensation
     return calculateGlyphWidth(fm, text);
 }
 
 qreal GlyphMetrics::textHeight(const QString &fontFamily, int pixelSize) const
 {
-    QFont font(fontFamily);
-    font.setPixelSize(pixelSize);
-    QFontMetricsF fm(font);
+    const QFontMetricsF &fm = fontCache(fontFamily, pixelSize).metrics;
     // Ceil to match Glyph component's qCeil(m_ascent + m_descent)
     return qCeil(fm.ascent() + fm.descent());
 }
 
 qreal GlyphMetrics::ascent(const QString &fontFamily, int pixelSize) const
 {
-    QFont font(fontFamily);
-    font.setPixelSize(pixelSize);
-    QFontMetricsF fm(font);
+    const QFontMetricsF &fm = fontCache(fontFamily, pixelSize).metrics;
     return fm.ascent();
 }
 
 qreal GlyphMetrics::descent(const QString &fontFamily, int pixelSize) const
 {
-    QFont font(fontFamily);
-    font.setPixelSize(pixelSize);
-    QFontMetricsF fm(font);
+    const QFontMetricsF &fm = fontCache(fontFamily, pixelSize).metrics;
     return fm.descent();
 }
 
 qreal GlyphMetrics::maxTextWidth(const QVariantList &texts, const QString &fontFamily, int pixelSize) const
 {
-    QFont font(fontFamily);
-    font.setPixelSize(pixelSize);
-    QFontMetricsF fm(font);
+    const QFontMetricsF &fm = fontCache(fontFamily, pixelSize).metrics;
 
     qreal maxWidth = 0;
     for (const QVariant &v : texts) {
@@ -99,9 +120,7 @@ qreal GlyphMetrics::numberWidth(qreal value, int decimalPoints, const QString &f
 
 qreal GlyphMetrics::maxNumberWidth(const QVariantList &values, int decimalPoints, const QString &fontFamily, int pixelSize) const
 {
-    QFont font(fontFamily);
-    font.setPixelSize(pixelSize);
-    QFontMetricsF fm(font);
+    const QFontMetricsF &fm = fontCache(fontFamily, pixelSize).metrics;
 
     qreal maxWidth = 0;
     for (const QVariant &v : values) {
@@ -117,9 +136,7 @@ qreal GlyphMetrics::maxNumberWidth(const QVariantList &values, int decimalPoints
 
 qreal GlyphMetrics::maxLeftPadding(const QVariantList &values, int decimalPoints, const QString &fontFamily, int pixelSize) const
 {
-    QFont font(fontFamily);
-    font.setPixelSize(pixelSize);
-    QFontMetricsF fm(font);
+    const QFontMetricsF &fm = fontCache(fontFamily, pixelSize).metrics;
 
     qreal maxPad = 0;
     for (const QVariant &v : values) {
@@ -139,9 +156,7 @@ qreal GlyphMetrics::maxLeftPadding(const QVariantList &values, int decimalPoints
 
 qreal GlyphMetrics::maxRightPadding(const QVariantList &values, int decimalPoints, const QString &fontFamily, int pixelSize) const
 {
-    QFont font(fontFamily);
-    font.setPixelSize(pixelSize);
-    QFontMetricsF fm(font);
+    const QFontMetricsF &fm = fontCache(fontFamily, pixelSize).metrics;
 
     qreal maxPad = 0;
     for (const QVariant &v : values) {
@@ -166,10 +181,8 @@ qreal GlyphMetrics::inkLeft(const QString &text, const QString &fontFamily, int
     if (text.isEmpty()) {
         return 0;
     }
-    QFont font(fontFamily);
-    font.setPixelSize(pixelSize);
-    QFontMetricsF fm(font);
-    QRectF ink = fm.boundingRect(text);
+    FontCache &cache = fontCache(fontFamily, pixelSize);
+    QRectF ink = inkBounds(cache, text);
     return ink.left();
 }
 
@@ -178,24 +191,20 @@ qreal GlyphMetrics::inkRight(const QString &text, const QString &fontFamily, int
     if (text.isEmpty()) {
         return 0;
     }
-    QFont font(fontFamily);
-    font.setPixelSize(pixelSize);
-    QFontMetricsF fm(font);
-    QRectF ink = fm.boundingRect(text);
+    FontCache &cache = fontCache(fontFamily, pixelSize);
+    QRectF ink = inkBounds(cache, text);
     return ink.left() + ink.width();
 }
 
 qreal GlyphMetrics::maxInkRight(const QVariantList &values, int decimalPoints, const QString &fontFamily, int pixelSize) const
 {
-    QFont font(fontFamily);
-    font.setPixelSize(pixelSize);
-    QFontMetricsF fm(font);
+    FontCache &cache = fontCache(fontFamily, pixelSize);
 
     qreal maxRight = 0;
     for (const QVariant &v : values) {
         QString text = QString::number(v.toDouble(), 'f', decimalPoints);
         if (!text.isEmpty()) {
-            QRectF ink = fm.boundingRect(text);
+            QRectF ink = inkBounds(cache, text);
             qreal right = ink.left() + ink.width();
             if (right > maxRight) {
                 maxRight = right;
@@ -207,15 +216,13 @@ qreal GlyphMetrics::maxInkRight(const QVariantList &values, int decimalPoints, c
 
 qreal GlyphMetrics::minInkLeft(const QVariantList &values, int decimalPoints, const QString &fontFamily, int pixelSize) const
 {
-    QFont font(fontFamily);
-    font.setPixelSize(pixelSize);
-    QFontMetricsF fm(font);
+    FontCache &cache = fontCache(fontFamily, pixelSize);
 
     qreal minLeft = 0;
     for (const QVariant &v : values) {
         QString text = QString::number(v.toDouble(), 'f', decimalPoints);
         if (!text.isEmpty()) {
-            QRectF ink = fm.boundingRect(text);
+            QRectF ink = inkBounds(cache, text);
             if (ink.left() < minLeft) {
                 minLeft = ink.left();
             }
@@ -230,24 +237,20 @@ qreal GlyphMetrics::inkWidth(const QString &text, const QString &fontFamily, int
     if (text.isEmpty()) {
         return 0;
     }
-    QFont font(fontFamily);
-    font.setPixelSize(pixelSize);
-    QFontMetricsF fm(font);
-    QRectF ink = fm.boundingRect(text);
+    FontCache &cache = fontCache(fontFamily, pixelSize);
+    QRectF ink = inkBounds(cache, text);
     return ink.width();
 }
 
 qreal GlyphMetrics::maxInkWidth(const QVariantList &values, int decimalPoints, const QString &fontFamily, int pixelSize) const
 {
-    QFont font(fontFamily);
-    font.setPixelSize(pixelSize);
-    QFontMetricsF fm(font);
+    FontCache &cache = fontCache(fontFamily, pixelSize);
 
     qreal maxWidth = 0;
     for (const QVariant &v : values) {
         QString text = QString::number(v.toDouble(), 'f', decimalPoints);
         if (!text.isEmpty()) {
-            QRectF ink = fm.boundingRect(text);
+            QRectF ink = inkBounds(cache, text);
             if (ink.width() > maxWidth) {
                 maxWidth = ink.width();
             }
@@ -3,11 +3,15 @@
 
 #pragma once
 
+#include <QHash>
 #include <QObject>
+#include <QRectF>
 #include <QString>
 #include <QVariantList>
 #include <QtQml/qqmlregistration.h>
 
+#include <memory>
+
 /*!
     \qmltype GlyphMetrics
     \inqmlmodule QuickPlotLib
@@ -23,6 +27,11 @@
     var maxWidth = GlyphMetrics.maxTextWidth(["0.00", "5.00", "10.00"], "sans-serif", 12);
     \endqml
 
+    Font metrics are cached per (family, pixel size), and ink bounds come from
+    GlyphRunCache. Every Axis in the engine, and every Glyph drawing its tick
+    labels, therefore reuses the same shaped strings instead of shaping them
+    again.
+
     \sa Axis, Glyph
 */
 class GlyphMetrics : public QObject {
@@ -127,4 +136,12 @@ public:
         Used by both LEFT and RIGHT axes to compute requiredThickness.
     */
     Q_INVOKABLE qreal maxInkWidth(const QVariantList &values, int decimalPoints, const QString &fontFamily, int pixelSize) const;
+
+private:
+    struct FontCache;
+
+    FontCache &fontCache(const QString &fontFamily, int pixelSize) const;
+    QRectF inkBounds(FontCache &cache, const QString &text) const;
+
+    mutable QHash<QString, std::shared_ptr<FontCache>> m_fontCaches;
 };
@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#include "GlyphRunCache.hpp"
+
+#include <QGlyphRun>
+#include <QHash>
+#include <QRawFont>
+#include <QTextOption>
+#include <QtMath>
+
+#include <limits>
+#include <utility>
+
+namespace {
+
+// The whole cache is dropped when it grows past this many labels. Glyphs
+// keep their own reference, so nothing on screen is affected.
+constexpr qsizetype kMaxCachedLabels = 4096;
+
+using Key = std::pair<QString, QString>; // (QFont::key(), text)
+
+QHash<Key, std::shared_ptr<const ShapedText>> &entries()
+{
+    static QHash<Key, std::shared_ptr<const ShapedText>> cache;
+    return cache;
+}
+
+std::shared_ptr<const ShapedText> shapeUncached(const QFont &font, const QString &text)
+{
+    auto shaped = std::make_shared<ShapedText>();
+
+    shaped->layout = std::make_unique<QTextLayout>(text, font);
+    QTextOption option;
+    option.setWrapMode(QTextOption::NoWrap);
+    shaped->layout->setTextOption(option);
+    shaped->layout->setCacheEnabled(true);
+    shaped->layout->beginLayout();
+    QTextLine line = shaped->layout->createLine();
+    shaped->layout->endLayout();
+
+    shaped->advance = line.horizontalAdvance();
+    shaped->baseline = line.ascent();
+
+    // Mirror QFontEngine::boundingBox() and tightBoundingBox() so the bounds
+    // match QFontMetricsF exactly, using the per-glyph boxes of the runs:
+    // left and top start at +inf (a positive bearing is kept), right and
+    // bottom at the origin, and glyphs without an advance are skipped.
+    // Run positions are in layout coordinates; bounds are baseline-relative.
+    const QPointF origin(line.x(), line.y() + line.ascent());
+    constexpr qreal inf = std::numeric_limits<qreal>::infinity();
+    qreal left = inf;
+    qreal top = inf;
+    qreal right = 0;
+    qreal bottom = 0;
+    QRectF tight;
+    const QList<QGlyphRun> runs = shaped->layout->glyphRuns();
+    for (const QGlyphRun &run : runs) {
+        const QRawFont rawFont = run.rawFont();
+        const QList<quint32> indexes = run.glyphIndexes();
+        const QList<QPointF> positions = run.positions();
+        const QList<QPointF> advances = rawFont.advancesForGlyphIndexes(indexes);
+        for (qsizetype i = 0; i < indexes.size(); ++i) {
+            if (advances[i].isNull()) {
+                continue;
+            }
+            const QRectF box = rawFont.boundingRect(indexes[i]).translated(positions[i] - origin);
+            left = qMin(left, box.left());
+            top = qMin(top, box.top());
+            right = qMax(right, qCeil(box.left()) + box.width());
+            bottom = qMax(bottom, qCeil(box.top()) + box.height());
+            if (box.width() > 0 || box.height() > 0) {
+                tight = tight.isNull() ? box : tight.united(box);
+            }
+        }
+    }
+    if (left != inf) {
+        shaped->boundingRect = QRectF(left, top, right - left, bottom - top);
+    }
+    shaped->tightBoundingRect = tight;
+
+    return shaped;
+}
+
+} // namespace
+
+namespace GlyphRunCache {
+
+std::shared_ptr<const ShapedText> shape(const QFont &font, const QString &text)
+{
+    if (text.isEmpty()) {
+        return nullptr;
+    }
+
+    auto &cache = entries();
+    const Key key(font.key(), text);
+    auto it = cache.constFind(key);
+    if (it != cache.constEnd()) {
+        return *it;
+    }
+
+    if (cache.size() >= kMaxCachedLabels) {
+        cache.clear();
+    }
+    std::shared_ptr<const ShapedText> shaped = shapeUncached(font, text);
+    cache.insert(key, shaped);
+    return shaped;
+}
+
+} // namespace GlyphRunCache
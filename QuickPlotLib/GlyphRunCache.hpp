@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QFont>
+#include <QRectF>
+#include <QString>
+#include <QTextLayout>
+
+#include <memory>
+
+/*!
+    \class ShapedText
+    \brief A label shaped once: its layout and ink bounds.
+
+    All rectangles are relative to the baseline origin of the text, with y
+    growing downward, like QFontMetricsF.
+*/
+struct ShapedText {
+    // Single-line layout holding the shaped glyphs; rendered by text nodes
+    // via QSGTextNode::addTextLayout(), which draws from the scene graph's
+    // shared glyph atlas
+    std::unique_ptr<QTextLayout> layout;
+
+    // Same as QFontMetricsF::boundingRect(text): the right and bottom edges
+    // include the origin and glyph positions are rounded up like the font
+    // engine does
+    QRectF boundingRect;
+
+    // Same as QFontMetricsF::tightBoundingRect(text)
+    QRectF tightBoundingRect;
+
+    // Logical advance of the text
+    qreal advance = 0;
+
+    // Distance from the top of the layout to the baseline
+    qreal baseline = 0;
+};
+
+/*!
+    \namespace GlyphRunCache
+    \brief Shaping cache shared by Glyph and GlyphMetrics.
+
+    Shaping a string (itemizing, HarfBuzz, glyph lookup) is the dominant
+    cost of a tick label. The cache shapes each (font, string) pair once and
+    hands out the result to every Glyph showing it and to GlyphMetrics, so
+    measuring a label for axis sizing and then drawing it shapes it only
+    once. Tick labels repeat heavily while panning, so most lookups hit.
+
+    Must be used from the GUI thread.
+
+    \sa Glyph, GlyphMetrics
+*/
+namespace GlyphRunCache {
+
+/*!
+    Returns \a text shaped with \a font, or null if \a text is empty. The
+    result is immutable and stays valid after it is evicted from the cache.
+*/
+std::shared_ptr<const ShapedText> shape(const QFont &font, const QString &text);
+
+} // namespace GlyphRunCache
@@ -93,6 +93,30 @@ Item {
     /*! View rectangle for data coordinates, delegated to GraphArea. */
     property alias viewRect: graphArea.viewRect
 
+    /*! Group sharing this graph's view range with other graphs. Default is null (unlinked). */
+    property ViewGroup viewGroup: null
+
+    // Group currently joined, so a reassignment can leave the old one
+    property ViewGroup __joinedViewGroup: null
+
+    function __syncViewGroup() {
+        if (__joinedViewGroup === viewGroup)
+            return;
+        if (__joinedViewGroup)
+            __joinedViewGroup.leave(root);
+        __joinedViewGroup = viewGroup;
+        if (viewGroup)
+            viewGroup.join(root);
+    }
+
+    onViewGroupChanged: __syncViewGroup()
+    Component.onCompleted: __syncViewGroup()
+
+    Component.onDestruction: {
+        if (__joinedViewGroup)
+            __joinedViewGroup.leave(root);
+    }
+
     // ---- Derived layout margins (3x3 conceptual grid) ---------------------
 
     readonly property bool hasLeftAxis: leftAxis !== null
@@ -15,8 +15,9 @@ Item {
     id: root
 
     /*!
-        The view rectangle defining the data coordinate bounds.
-        Format: Qt.rect(left, top, width, height)
+        The view rectangle defining the data coordinate bounds, with y
+        growing upward like Series.viewRect.
+        Format: Qt.rect(left, bottom, width, height)
     */
     property rect viewRect: Qt.rect(0, 0, 100, 100)
 
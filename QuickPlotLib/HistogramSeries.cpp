@@ -0,0 +1,534 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#include "HistogramSeries.hpp"
+
+#include "Parallel.hpp"
+
+#include <QSGFlatColorMaterial>
+#include <QSGGeometryNode>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+// Number of ring slices making up the sliding window in Window mode
+constexpr int kWindowSlices = 20;
+
+// Refresh interval while counts decay or expire
+constexpr int kTickIntervalMs = 16;
+
+// Below this many samples per worker a batch is binned on the calling
+// thread; producers calling concurrently are already parallel
+constexpr qsizetype kMinSamplesPerWorker = 1 << 18;
+
+// Decayed counts below this are dropped, so the refresh timer stops once the
+// histogram has faded out
+constexpr double kDecayFloor = 1e-3;
+
+} // namespace
+
+// Bin geometry shared with producer threads. Immutable except for the
+// pending counters, which producers increment and the GUI thread drains,
+// and the writer bookkeeping that tells the drain when a replaced layout
+// can no longer receive counts.
+struct HistogramSeries::Layout {
+    Layout(double low, double width, int bins, bool autoRange)
+        : low(low)
+        , width(width)
+        , binWidth(width / bins)
+        , bins(bins)
+        , autoRange(autoRange)
+        , pending(new std::atomic<quint64>[size_t(bins)])
+    {
+        for (int i = 0; i < bins; ++i) {
+            pending[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    const double low;
+    const double width;
+    const double binWidth;
+    const int bins;
+    const bool autoRange;
+    std::unique_ptr<std::atomic<quint64>[]> pending;
+
+    // Producers currently adding to pending, and whether the layout has been
+    // replaced; see addPending()
+    std::atomic<int> writers { 0 };
+    std::atomic<bool> retired { false };
+};
+
+struct HistogramSeries::BatchBins {
+    std::vector<quint64> counts;
+    double low = std::numeric_limits<double>::infinity();
+    double high = -std::numeric_limits<double>::infinity();
+    qsizetype outside = 0;
+};
+
+// Bins a batch with one private partial histogram per worker and sums the
+// partials. Also reports the finite range of the batch and how many samples
+// fell outside the layout.
+HistogramSeries::BatchBins HistogramSeries::binBatch(const double *samples, qsizetype count, const Layout &layout)
+{
+    const int workers = Parallel::workerCount(count, kMinSamplesPerWorker);
+    std::vector<BatchBins> partial(size_t(workers));
+    Parallel::run(workers, [&](int worker) {
+        BatchBins &bins = partial[size_t(worker)];
+        bins.counts.assign(size_t(layout.bins), 0);
+
+        const double high = layout.low + layout.width;
+        auto [begin, end] = Parallel::sliceFor(worker, workers, count);
+        for (qsizetype i = begin; i < end; ++i) {
+            const double v = samples[i];
+            if (!std::isfinite(v)) {
+                continue;
+            }
+            bins.low = qMin(bins.low, v);
+            bins.high = qMax(bins.high, v);
+            if (v >= layout.low && v < high) {
+                const int bin = qMin(layout.bins - 1, int((v - layout.low) / layout.binWidth));
+                ++bins.counts[size_t(bin)];
+            } else {
+                ++bins.outside;
+            }
+        }
+    });
+
+    BatchBins &result = partial[0];
+    for (size_t w = 1; w < partial.size(); ++w) {
+        for (size_t i = 0; i < result.counts.size(); ++i) {
+            result.counts[i] += partial[w].counts[i];
+        }
+        result.low = qMin(result.low, partial[w].low);
+        result.high = qMax(result.high, partial[w].high);
+        result.outside += partial[w].outside;
+    }
+    return std::move(result);
+}
+
+// Adds a binned batch to the pending counts of \a layout, unless the layout
+// has been retired, in which case nothing is added and false is returned.
+// The writer registers before checking the flag and the drain checks the
+// writer count after the flag was set (both sequentially consistent), so
+// either the drain waits for this writer or this writer sees the flag.
+bool HistogramSeries::addPending(Layout &layout, const BatchBins &batch)
+{
+    layout.writers.fetch_add(1);
+    if (layout.retired.load()) {
+        layout.writers.fetch_sub(1);
+        return false;
+    }
+    for (int i = 0; i < layout.bins; ++i) {
+        if (batch.counts[size_t(i)]) {
+            layout.pending[i].fetch_add(batch.counts[size_t(i)], std::memory_order_relaxed);
+        }
+    }
+    layout.writers.fetch_sub(1);
+    return true;
+}
+
+// Index of the bin of \a to containing the center of bin \a bin of \a from,
+// or -1 if it lies outside
+int HistogramSeries::remapBin(const Layout &from, int bin, const Layout &to)
+{
+    const double center = from.low + (bin + 0.5) * from.binWidth;
+    const double target = std::floor((center - to.low) / to.binWidth);
+    return (target >= 0 && target < to.bins) ? int(target) : -1;
+}
+
+HistogramSeries::HistogramSeries(QQuickItem *parent)
+    : Series(parent)
+{
+    setFlag(ItemHasContents, true);
+    m_clock.start();
+    m_tickTimer.setInterval(kTickIntervalMs);
+    connect(&m_tickTimer, &QTimer::timeout, this, [this]() { polish(); });
+    connect(this, &Series::viewRectChanged, this, &QQuickItem::update);
+    resetLayout();
+}
+
+HistogramSeries::~HistogramSeries() = default;
+
+void HistogramSeries::setBinCount(int count)
+{
+    count = qMax(1, count);
+    if (m_binCount == count) {
+        return;
+    }
+    m_binCount = count;
+    resetLayout();
+    emit binningChanged();
+}
+
+void HistogramSeries::setMinimum(qreal minimum)
+{
+    if (m_minimum == minimum) {
+        return;
+    }
+    m_minimum = minimum;
+    resetLayout();
+    emit binningChanged();
+}
+
+void HistogramSeries::setMaximum(qreal maximum)
+{
+    if (m_maximum == maximum) {
+        return;
+    }
+    m_maximum = maximum;
+    resetLayout();
+    emit binningChanged();
+}
+
+void HistogramSeries::setAutoRange(bool autoRange)
+{
+    if (m_autoRange == autoRange) {
+        return;
+    }
+    m_autoRange = autoRange;
+    resetLayout();
+    emit binningChanged();
+}
+
+void HistogramSeries::setMode(Mode mode)
+{
+    if (m_mode == mode) {
+        return;
+    }
+    m_mode = mode;
+    resetSlices();
+    updateDisplay();
+    emit modeChanged();
+}
+
+void HistogramSeries::setHalfLife(qreal seconds)
+{
+    if (m_halfLife == seconds || seconds <= 0) {
+        return;
+    }
+    m_halfLife = seconds;
+    emit halfLifeChanged();
+}
+
+void HistogramSeries::setWindowDuration(qreal seconds)
+{
+    if (m_windowDuration == seconds || seconds <= 0) {
+        return;
+    }
+    m_windowDuration = seconds;
+    emit windowDurationChanged();
+}
+
+void HistogramSeries::setColor(const QColor &color)
+{
+    if (m_color == color) {
+        return;
+    }
+    m_color = color;
+    emit colorChanged();
+    update();
+}
+
+void HistogramSeries::addSamples(const QByteArray &samples)
+{
+    addSamples(reinterpret_cast<const double *>(samples.constData()), samples.size() / qsizetype(sizeof(double)));
+}
+
+void HistogramSeries::addSamples(const double *samples, qsizetype count)
+{
+    if (!samples || count <= 0) {
+        return;
+    }
+
+    LayoutPtr layout = std::atomic_load(&m_layout);
+    for (;;) {
+        BatchBins batch = binBatch(samples, count, *layout);
+
+        // Rare path: grow the range, then bin again against the new edges
+        if (batch.outside > 0 && layout->autoRange) {
+            layout = expandLayout(batch.low, batch.high);
+            batch = binBatch(samples, count, *layout);
+        }
+
+        if (addPending(*layout, batch)) {
+            break;
+        }
+        // Another producer grew the range meanwhile; bin against the new one
+        layout = std::atomic_load(&m_layout);
+    }
+
+    requestDrain();
+}
+
+void HistogramSeries::clear()
+{
+    resetLayout();
+}
+
+QList<qreal> HistogramSeries::counts() const
+{
+    return QList<qreal>(m_display.cbegin(), m_display.cend());
+}
+
+QList<qreal> HistogramSeries::binEdges() const
+{
+    QList<qreal> edges;
+    if (!m_drainedLayout) {
+        return edges;
+    }
+    edges.reserve(m_drainedLayout->bins + 1);
+    for (int i = 0; i <= m_drainedLayout->bins; ++i) {
+        edges.append(m_drainedLayout->low + i * m_drainedLayout->binWidth);
+    }
+    return edges;
+}
+
+HistogramSeries::LayoutPtr HistogramSeries::expandLayout(double low, double high)
+{
+    QMutexLocker locker(&m_layoutMutex);
+    LayoutPtr current = std::atomic_load(&m_layout);
+
+    // Double the range towards the outliers. Doubling keeps every old bin
+    // inside exactly one new bin, so carried-over counts stay exact.
+    double newLow = current->low;
+    double newWidth = current->width;
+    while (low < newLow) {
+        newLow -= newWidth;
+        newWidth *= 2;
+    }
+    while (high >= newLow + newWidth) {
+        newWidth *= 2;
+    }
+
+    if (newLow == current->low && newWidth == current->width) {
+        // Another producer already grew it far enough
+        return current;
+    }
+
+    auto next = std::make_shared<Layout>(newLow, newWidth, current->bins, current->autoRange);
+    current->retired.store(true);
+    m_retired.append(current);
+    std::atomic_store(&m_layout, next);
+    return next;
+}
+
+void HistogramSeries::resetLayout()
+{
+    const double low = qMin(m_minimum, m_maximum);
+    const double width = qAbs(m_maximum - m_minimum) > 0 ? qAbs(m_maximum - m_minimum) : 1.0;
+    auto next = std::make_shared<Layout>(low, width, m_binCount, m_autoRange);
+    {
+        QMutexLocker locker(&m_layoutMutex);
+        m_retired.clear();
+        std::atomic_store(&m_layout, next);
+    }
+
+    m_drainedLayout = next;
+    resetSlices();
+    updateDisplay();
+}
+
+void HistogramSeries::resetSlices()
+{
+    const int sliceCount = m_mode == Window ? kWindowSlices : 1;
+    const int bins = m_drainedLayout ? m_drainedLayout->bins : 0;
+    m_slices.assign(size_t(sliceCount), std::vector<double>(size_t(bins), 0.0));
+    m_currentSlice = 0;
+    m_lastTick = m_clock.elapsed();
+    m_sliceStart = m_lastTick;
+}
+
+void HistogramSeries::requestDrain()
+{
+    // One queued drain per frame no matter how many batches arrive
+    if (!m_drainRequested.exchange(true)) {
+        QMetaObject::invokeMethod(this, [this]() { polish(); }, Qt::QueuedConnection);
+    }
+}
+
+void HistogramSeries::updatePolish()
+{
+    drain();
+}
+
+void HistogramSeries::advanceTime()
+{
+    const qint64 now = m_clock.elapsed();
+    const qint64 elapsed = now - m_lastTick;
+    m_lastTick = now;
+
+    if (m_mode == Decay && elapsed > 0) {
+        const double factor = std::exp2(-elapsed / (1000.0 * m_halfLife));
+        for (double &count : m_slices[0]) {
+            count *= factor;
+            if (count < kDecayFloor) {
+                count = 0;
+            }
+        }
+    } else if (m_mode == Window) {
+        // Expire the oldest slices that fell out of the window
+        const double sliceMs = 1000.0 * m_windowDuration / kWindowSlices;
+        const qint64 steps = qint64((now - m_sliceStart) / sliceMs);
+        for (qint64 step = 0; step < qMin<qint64>(steps, kWindowSlices); ++step) {
+            m_currentSlice = (m_currentSlice + 1) % kWindowSlices;
+            std::fill(m_slices[size_t(m_currentSlice)].begin(), m_slices[size_t(m_currentSlice)].end(), 0.0);
+        }
+        if (steps > 0) {
+            m_sliceStart = steps < kWindowSlices ? m_sliceStart + qint64(steps * sliceMs) : now;
+        }
+    }
+}
+
+void HistogramSeries::drain()
+{
+    // Batches added from here on request another drain
+    m_drainRequested.store(false);
+
+    const LayoutPtr layout = std::atomic_load(&m_layout);
+    advanceTime();
+
+    // autoRange grew the bins: carry the existing counts over by bin center
+    if (layout != m_drainedLayout) {
+        for (std::vector<double> &slice : m_slices) {
+            std::vector<double> remapped(size_t(layout->bins), 0.0);
+            for (int bin = 0; bin < m_drainedLayout->bins; ++bin) {
+                const int target = remapBin(*m_drainedLayout, bin, *layout);
+                if (target >= 0) {
+                    remapped[size_t(target)] += slice[size_t(bin)];
+                }
+            }
+            slice = std::move(remapped);
+        }
+        m_drainedLayout = layout;
+        m_minimum = layout->low;
+        m_maximum = layout->low + layout->width;
+        emit binningChanged();
+    }
+
+    std::vector<double> &slice = m_slices[size_t(m_currentSlice)];
+    auto collect = [&](Layout &from) {
+        for (int bin = 0; bin < from.bins; ++bin) {
+            const quint64 count = from.pending[bin].exchange(0, std::memory_order_relaxed);
+            if (count == 0) {
+                continue;
+            }
+            const int target = &from == layout.get() ? bin : remapBin(from, bin, *layout);
+            if (target >= 0) {
+                slice[size_t(target)] += double(count);
+            }
+        }
+    };
+
+    // Producers that loaded a layout before it was replaced may still be
+    // adding to it. Once a retired layout has no writers, none can start (see
+    // addPending()), so collecting it after that check is final and it can
+    // be dropped without losing a late batch.
+    QList<LayoutPtr> retired;
+    {
+        QMutexLocker locker(&m_layoutMutex);
+        retired = m_retired;
+    }
+    QList<Layout *> released;
+    for (const LayoutPtr &old : std::as_const(retired)) {
+        if (old->writers.load() == 0) {
+            released.append(old.get());
+        }
+        collect(*old);
+    }
+    if (!released.isEmpty()) {
+        QMutexLocker locker(&m_layoutMutex);
+        m_retired.removeIf([&](const LayoutPtr &old) { return released.contains(old.get()); });
+    }
+
+    collect(*layout);
+    updateDisplay();
+}
+
+void HistogramSeries::updateDisplay()
+{
+    const size_t bins = m_drainedLayout ? size_t(m_drainedLayout->bins) : 0;
+    m_display.assign(bins, 0.0);
+    for (const std::vector<double> &slice : m_slices) {
+        for (size_t i = 0; i < bins; ++i) {
+            m_display[i] += slice[i];
+        }
+    }
+
+    m_total = 0;
+    m_maxCount = 0;
+    for (double count : m_display) {
+        m_total += count;
+        m_maxCount = qMax(m_maxCount, count);
+    }
+
+    // Keep ticking while counts can still change without new samples
+    if (m_mode != Cumulative && m_total > 0) {
+        if (!m_tickTimer.isActive()) {
+            m_tickTimer.start();
+        }
+    } else {
+        m_tickTimer.stop();
+    }
+
+    emit countsChanged();
+    update();
+}
+
+QSGNode *HistogramSeries::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *)
+{
+    if (m_display.empty() || width() <= 0 || height() <= 0) {
+        delete oldNode;
+        return nullptr;
+    }
+
+    auto *node = static_cast<QSGGeometryNode *>(oldNode);
+    if (!node) {
+        node = new QSGGeometryNode();
+
+        auto *geometry = new QSGGeometry(QSGGeometry::defaultAttributes_Point2D(), 0);
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        node->setGeometry(geometry);
+        node->setFlag(QSGNode::OwnsGeometry);
+
+        node->setMaterial(new QSGFlatColorMaterial());
+        node->setFlag(QSGNode::OwnsMaterial);
+    }
+
+    // Two triangles per bar, all bars in one geometry
+    const int bins = int(m_display.size());
+    QSGGeometry *geometry = node->geometry();
+    if (geometry->vertexCount() != bins * 6) {
+        geometry->allocate(bins * 6);
+    }
+
+    QSGGeometry::Point2D *vertices = geometry->vertexDataAsPoint2D();
+    const double low = m_drainedLayout->low;
+    const double binWidth = m_drainedLayout->binWidth;
+    const float base = float(mapFromData(0, 0).y());
+    for (int i = 0; i < bins; ++i) {
+        const QPointF topLeft = mapFromData(low + i * binWidth, m_display[size_t(i)]);
+        const float x0 = float(topLeft.x());
+        const float x1 = float(mapFromData(low + (i + 1) * binWidth, 0).x());
+        const float top = float(topLeft.y());
+
+        QSGGeometry::Point2D *v = vertices + i * 6;
+        v[0].set(x0, top);
+        v[1].set(x1, top);
+        v[2].set(x0, base);
+        v[3].set(x1, top);
+        v[4].set(x1, base);
+        v[5].set(x0, base);
+    }
+    node->markDirty(QSGNode::DirtyGeometry);
+
+    auto *material = static_cast<QSGFlatColorMaterial *>(node->material());
+    if (material->color() != m_color) {
+        material->setColor(m_color);
+        node->markDirty(QSGNode::DirtyMaterial);
+    }
+
+    return node;
+}
@@ -0,0 +1,235 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "Series.hpp"
+
+#include <QByteArray>
+#include <QColor>
+#include <QElapsedTimer>
+#include <QList>
+#include <QMutex>
+#include <QTimer>
+#include <QtQml/qqmlregistration.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+/*!
+    \qmltype HistogramSeries
+    \inqmlmodule QuickPlotLib
+    \inherits Series
+    \brief Streaming histogram of live samples, drawn as bars.
+
+    Samples are added in batches with addSamples(), from any thread. Each batch
+    is binned in parallel into per-worker partial counts, which are then
+    merged with atomic adds into the pending bins of the current bin layout;
+    producers never take a lock on this path. Once per frame the GUI thread
+    drains the pending bins into the displayed counts and rebuilds the bars,
+    which are rendered as a single geometry node.
+
+    With autoRange enabled, a batch reaching outside [minimum, maximum)
+    doubles the range towards the outlier until it fits. Existing counts are
+    carried over by bin center, so nothing already counted is lost.
+
+    Live data can be shown cumulatively, with exponential decay, or over a
+    sliding time window (see mode).
+
+    Producers must stop calling addSamples() before the item is destroyed.
+
+    From Python:
+    \code
+    histogram.addSamples(batch.astype(numpy.float64).tobytes())
+    \endcode
+
+    Bars stand on y = 0 and are one count tall per data unit.
+
+    \sa Series
+*/
+class HistogramSeries : public Series {
+    Q_OBJECT
+    QML_ELEMENT
+
+    /*!
+        Number of bins between minimum and maximum. Changing it clears the
+        histogram.
+    */
+    Q_PROPERTY(int binCount READ binCount WRITE setBinCount NOTIFY binningChanged)
+
+    /*!
+        Lower edge of the first bin. Setting it clears the histogram.
+    */
+    Q_PROPERTY(qreal minimum READ minimum WRITE setMinimum NOTIFY binningChanged)
+
+    /*!
+        Upper edge of the last bin. Setting it clears the histogram.
+    */
+    Q_PROPERTY(qreal maximum READ maximum WRITE setMaximum NOTIFY binningChanged)
+
+    /*!
+        Whether the bin range grows to include samples outside it. When false,
+        such samples are ignored.
+    */
+    Q_PROPERTY(bool autoRange READ autoRange WRITE setAutoRange NOTIFY binningChanged)
+
+    /*!
+        How counts evolve over time.
+        \value HistogramSeries.Cumulative Counts only grow
+        \value HistogramSeries.Decay Counts decay exponentially with halfLife
+        \value HistogramSeries.Window Only samples from the last windowDuration count
+        Changing the mode clears the counts.
+    */
+    Q_PROPERTY(Mode mode READ mode WRITE setMode NOTIFY modeChanged)
+
+    /*!
+        Half-life in seconds of the counts in Decay mode.
+    */
+    Q_PROPERTY(qreal halfLife READ halfLife WRITE setHalfLife NOTIFY halfLifeChanged)
+
+    /*!
+        Length in seconds of the sliding window in Window mode.
+    */
+    Q_PROPERTY(qreal windowDuration READ windowDuration WRITE setWindowDuration NOTIFY windowDurationChanged)
+
+    /*!
+        Bar fill color.
+    */
+    Q_PROPERTY(QColor color READ color WRITE setColor NOTIFY colorChanged)
+
+    /*!
+        The sum of all displayed counts. Read-only.
+    */
+    Q_PROPERTY(qreal total READ total NOTIFY countsChanged)
+
+    /*!
+        The tallest displayed bar. Read-only.
+    */
+    Q_PROPERTY(qreal maxCount READ maxCount NOTIFY countsChanged)
+
+public:
+    enum Mode {
+        Cumulative,
+        Decay,
+        Window
+    };
+    Q_ENUM(Mode)
+
+    explicit HistogramSeries(QQuickItem *parent = nullptr);
+    ~HistogramSeries() override;
+
+    int binCount() const { return m_binCount; }
+    void setBinCount(int count);
+
+    qreal minimum() const { return m_minimum; }
+    void setMinimum(qreal minimum);
+
+    qreal maximum() const { return m_maximum; }
+    void setMaximum(qreal maximum);
+
+    bool autoRange() const { return m_autoRange; }
+    void setAutoRange(bool autoRange);
+
+    Mode mode() const { return m_mode; }
+    void setMode(Mode mode);
+
+    qreal halfLife() const { return m_halfLife; }
+    void setHalfLife(qreal seconds);
+
+    qreal windowDuration() const { return m_windowDuration; }
+    void setWindowDuration(qreal seconds);
+
+    QColor color() const { return m_color; }
+    void setColor(const QColor &color);
+
+    qreal total() const { return m_total; }
+    qreal maxCount() const { return m_maxCount; }
+
+    /*!
+        Adds a batch of \a count samples. Thread-safe; non-finite samples are
+        ignored.
+    */
+    void addSamples(const double *samples, qsizetype count);
+
+    /*!
+        Adds a batch of float64 samples. Thread-safe.
+    */
+    Q_INVOKABLE void addSamples(const QByteArray &samples);
+
+    /*!
+        Removes all counts.
+    */
+    Q_INVOKABLE void clear();
+
+    /*!
+        Returns the displayed count of every bin.
+    */
+    Q_INVOKABLE QList<qreal> counts() const;
+
+    /*!
+        Returns the binCount + 1 bin edges.
+    */
+    Q_INVOKABLE QList<qreal> binEdges() const;
+
+signals:
+    void binningChanged();
+    void modeChanged();
+    void halfLifeChanged();
+    void windowDurationChanged();
+    void colorChanged();
+    void countsChanged();
+
+protected:
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData) override;
+    void updatePolish() override;
+
+private:
+    struct Layout;
+    struct BatchBins;
+    using LayoutPtr = std::shared_ptr<Layout>;
+
+    static BatchBins binBatch(const double *samples, qsizetype count, const Layout &layout);
+    static bool addPending(Layout &layout, const BatchBins &batch);
+    static int remapBin(const Layout &from, int bin, const Layout &to);
+
+    LayoutPtr expandLayout(double low, double high);
+    void resetLayout();
+    void requestDrain();
+    void drain();
+    void advanceTime();
+    void resetSlices();
+    void updateDisplay();
+
+    // Written by the GUI thread only; producers read m_layout instead
+    int m_binCount = 64;
+    qreal m_minimum = 0;
+    qreal m_maximum = 1;
+    bool m_autoRange = false;
+
+    Mode m_mode = Cumulative;
+    qreal m_halfLife = 1;
+    qreal m_windowDuration = 10;
+    QColor m_color = QColor("#4682B4");
+
+    // Layout producers bin into. Swapped atomically when autoRange grows it;
+    // replaced layouts stay in m_retired until every producer let go of them.
+    LayoutPtr m_layout;
+    QMutex m_layoutMutex;
+    QList<LayoutPtr> m_retired;
+    std::atomic<bool> m_drainRequested { false };
+
+    // GUI-side counts. Decay and Cumulative use one slice; Window keeps a
+    // ring of slices covering windowDuration.
+    LayoutPtr m_drainedLayout;
+    std::vector<std::vector<double>> m_slices;
+    int m_currentSlice = 0;
+    QElapsedTimer m_clock;
+    qint64 m_lastTick = 0;
+    qint64 m_sliceStart = 0;
+    QTimer m_tickTimer;
+
+    std::vector<double> m_display;
+    qreal m_total = 0;
+    qreal m_maxCount = 0;
+};
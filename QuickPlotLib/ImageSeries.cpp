@@ -0,0 +1,349 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#include "ImageSeries.hpp"
+
+#include "Colormap.hpp"
+#include "ColormapMaterial.hpp"
+#include "FloatTexture.hpp"
+
+#include <QQuickWindow>
+#include <QSGGeometryNode>
+#include <QtMath>
+
+#include <algorithm>
+
+namespace {
+
+// One TileSize x TileSize block of the image
+class ImageTileNode : public QSGGeometryNode {
+public:
+    ImageTileNode(int tileRow, int tileColumn, int width)
+        : quad(QSGGeometry::defaultAttributes_TexturedPoint2D(), 4)
+        , tileRow(tileRow)
+        , tileColumn(tileColumn)
+        , width(width)
+    {
+        quad.setDrawingMode(QSGGeometry::DrawTriangleStrip);
+        setGeometry(&quad);
+        material.setDataTexture(&texture);
+        setMaterial(&material);
+    }
+
+    QSGGeometry quad;
+    FloatTexture texture;
+    ColormapMaterial material;
+
+    const int tileRow;
+    const int tileColumn;
+    const int width;
+
+    // Rows of this tile already uploaded to the texture
+    int uploadedRows = 0;
+};
+
+class ImageSeriesNode : public QSGNode {
+public:
+    ~ImageSeriesNode() override { delete lut; }
+
+    QSGTexture *lut = nullptr;
+    int dataGeneration = -1;
+    QList<ImageTileNode *> tiles;
+};
+
+} // namespace
+
+ImageSeries::ImageSeries(QQuickItem *parent)
+    : Series(parent)
+{
+    setFlag(ItemHasContents, true);
+    connect(this, &Series::viewRectChanged, this, [this]() { m_geometryDirty = true; });
+}
+
+ImageSeries::~ImageSeries() = default;
+
+void ImageSeries::setExtent(const QRectF &extent)
+{
+    if (m_extent == extent) {
+        return;
+    }
+    m_extent = extent;
+    m_geometryDirty = true;
+    emit extentChanged();
+    update();
+}
+
+void ImageSeries::setVmin(qreal vmin)
+{
+    if (m_vmin == vmin) {
+        return;
+    }
+    m_vmin = vmin;
+    m_levelsDirty = true;
+    emit vminChanged();
+    update();
+}
+
+void ImageSeries::setVmax(qreal vmax)
+{
+    if (m_vmax == vmax) {
+        return;
+    }
+    m_vmax = vmax;
+    m_levelsDirty = true;
+    emit vmaxChanged();
+    update();
+}
+
+void ImageSeries::setColormap(const QString &colormap)
+{
+    if (m_colormap == colormap) {
+        return;
+    }
+    if (!Colormap::contains(colormap)) {
+        qWarning("ImageSeries: unknown colormap \"%s\"", qPrintable(colormap));
+        return;
+    }
+    m_colormap = colormap;
+    m_colormapDirty = true;
+    emit colormapChanged();
+    update();
+}
+
+void ImageSeries::setMaxRows(int rows)
+{
+    rows = qMax(0, rows);
+    if (m_maxRows == rows) {
+        return;
+    }
+    m_maxRows = rows;
+    emit maxRowsChanged();
+    if (trimRows()) {
+        emit dataChanged();
+        update();
+    }
+}
+
+void ImageSeries::setData(const QByteArray &data, int columns)
+{
+    const qsizetype rowBytes = qsizetype(columns) * qsizetype(sizeof(float));
+    if (columns <= 0 || data.size() % rowBytes != 0) {
+        qWarning("ImageSeries::setData: size %lld is not a multiple of %d float columns",
+                 qlonglong(data.size()), columns);
+        return;
+    }
+
+    const int rows = int(data.size() / rowBytes);
+    m_chunks.clear();
+    if (rows > 0) {
+        m_chunks.append({ data, 0, rows });
+    }
+    m_columns = columns;
+    m_rows = rows;
+    m_firstRow = 0;
+    trimRows();
+    ++m_dataGeneration;
+    m_geometryDirty = true;
+    emit dataChanged();
+    update();
+}
+
+void ImageSeries::appendRows(const QByteArray &data)
+{
+    if (m_columns <= 0) {
+        qWarning("ImageSeries::appendRows: call setData() first to define the number of columns");
+        return;
+    }
+
+    const qsizetype rowBytes = qsizetype(m_columns) * qsizetype(sizeof(float));
+    if (data.size() % rowBytes != 0) {
+        qWarning("ImageSeries::appendRows: size %lld is not a multiple of %d float columns",
+                 qlonglong(data.size()), m_columns);
+        return;
+    }
+
+    const int rows = int(data.size() / rowBytes);
+    if (rows == 0) {
+        return;
+    }
+
+    m_chunks.append({ data, m_rows, rows });
+    m_rows += rows;
+    trimRows();
+    m_geometryDirty = true;
+    emit dataChanged();
+    update();
+}
+
+void ImageSeries::clear()
+{
+    if (m_rows == 0 && m_columns == 0) {
+        return;
+    }
+    m_chunks.clear();
+    m_columns = 0;
+    m_rows = 0;
+    m_firstRow = 0;
+    ++m_dataGeneration;
+    emit dataChanged();
+    update();
+}
+
+void ImageSeries::geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    Series::geometryChange(newGeometry, oldGeometry);
+    if (newGeometry.size() != oldGeometry.size()) {
+        m_geometryDirty = true;
+        update();
+    }
+}
+
+QRectF ImageSeries::effectiveExtent() const
+{
+    if (m_extent.isEmpty()) {
+        return QRectF(0, m_firstRow, m_columns, rows());
+    }
+    return m_extent;
+}
+
+// Drops whole tile rows from the bottom while more than maxRows rows are
+// held. Returns true if any rows were dropped.
+bool ImageSeries::trimRows()
+{
+    if (m_maxRows <= 0 || rows() - m_maxRows < TileSize) {
+        return false;
+    }
+    m_firstRow += (rows() - m_maxRows) / TileSize * TileSize;
+
+    // A chunk straddling firstRow is kept whole; its dropped rows are never read
+    m_chunks.removeIf([this](const Chunk &chunk) { return chunk.firstRow + chunk.rows <= m_firstRow; });
+    m_geometryDirty = true;
+    return true;
+}
+
+void ImageSeries::uploadTileRows(FloatTexture *texture, int tileRow, int tileColumn, int tileWidth,
+                                 int firstRow, int endRow) const
+{
+    const int rowOffset = tileRow * TileSize;
+    const int columnOffset = tileColumn * TileSize;
+    const int stride = m_columns * int(sizeof(float));
+
+    // First chunk that ends after firstRow
+    auto it = std::upper_bound(m_chunks.cbegin(), m_chunks.cend(), firstRow,
+                               [](int row, const Chunk &chunk) { return row < chunk.firstRow + chunk.rows; });
+
+    for (; it != m_chunks.cend() && it->firstRow < endRow; ++it) {
+        const int begin = qMax(firstRow, it->firstRow);
+        const int end = qMin(endRow, it->firstRow + it->rows);
+        const qsizetype offset = (qsizetype(begin - it->firstRow) * m_columns + columnOffset) * qsizetype(sizeof(float));
+        texture->uploadRegion(it->data, offset, stride, QRect(0, begin - rowOffset, tileWidth, end - begin));
+    }
+}
+
+QSGNode *ImageSeries::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *)
+{
+    if (rows() <= 0 || m_columns <= 0 || width() <= 0 || height() <= 0 || !window()) {
+        delete oldNode;
+        return nullptr;
+    }
+
+    auto *root = static_cast<ImageSeriesNode *>(oldNode);
+    if (!root) {
+        root = new ImageSeriesNode();
+        m_colormapDirty = true;
+    }
+
+    // New data replaced the old rows: drop every tile
+    if (root->dataGeneration != m_dataGeneration) {
+        for (ImageTileNode *tile : std::as_const(root->tiles)) {
+            root->removeChildNode(tile);
+            delete tile;
+        }
+        root->tiles.clear();
+        root->dataGeneration = m_dataGeneration;
+    }
+
+    bool materialDirty = m_levelsDirty;
+    if (m_colormapDirty) {
+        delete root->lut;
+        root->lut = Colormap::createLutTexture(window(), m_colormap);
+        materialDirty = true;
+    }
+
+    // Tile rows that maxRows dropped are at the front
+    const int tileColumns = (m_columns + TileSize - 1) / TileSize;
+    const int firstTileRow = m_firstRow / TileSize;
+    while (!root->tiles.isEmpty() && root->tiles.first()->tileRow < firstTileRow) {
+        ImageTileNode *tile = root->tiles.takeFirst();
+        root->removeChildNode(tile);
+        delete tile;
+    }
+
+    // Rows only ever grow within a generation, so new tiles are appended
+    const int tileRows = (m_rows + TileSize - 1) / TileSize;
+    for (int index = firstTileRow * tileColumns + int(root->tiles.size()); index < tileRows * tileColumns; ++index) {
+        const int tileColumn = index % tileColumns;
+        const int tileWidth = qMin(TileSize, m_columns - tileColumn * TileSize);
+        auto *tile = new ImageTileNode(index / tileColumns, tileColumn, tileWidth);
+        root->tiles.append(tile);
+        root->appendChildNode(tile);
+    }
+
+    const QRectF extent = effectiveExtent();
+    const float vmin = float(m_vmin);
+    const float vmax = float(m_vmax);
+
+    for (ImageTileNode *tile : std::as_const(root->tiles)) {
+        const int firstRow = tile->tileRow * TileSize;
+        const int tileHeight = qMin(TileSize, m_rows - firstRow);
+        bool uploaded = false;
+        bool materialChanged = false;
+
+        // Upload only the rows this tile has not seen yet. The texture grows
+        // in powers of two so a slowly filling tile is not reallocated per row.
+        if (tile->uploadedRows < tileHeight) {
+            if (tileHeight > tile->texture.textureSize().height()) {
+                const int capacity = qBound(16, int(qNextPowerOfTwo(quint32(tileHeight - 1))), TileSize);
+                tile->texture.setTextureSize(QSize(tile->width, capacity));
+                tile->uploadedRows = 0;
+            }
+            uploadTileRows(&tile->texture, tile->tileRow, tile->tileColumn, tile->width,
+                           firstRow + tile->uploadedRows, firstRow + tileHeight);
+            tile->uploadedRows = tileHeight;
+            uploaded = true;
+        }
+
+        if (materialDirty || tile->material.lutTexture() != root->lut) {
+            tile->material.setLevels(vmin, vmax);
+            tile->material.setLutTexture(root->lut);
+            materialChanged = true;
+        }
+
+        if (m_geometryDirty || uploaded) {
+            const int firstColumn = tile->tileColumn * TileSize;
+            const qreal x0 = extent.left() + extent.width() * firstColumn / m_columns;
+            const qreal x1 = extent.left() + extent.width() * (firstColumn + tile->width) / m_columns;
+            const qreal y0 = extent.top() + extent.height() * (firstRow - m_firstRow) / rows();
+            const qreal y1 = extent.top() + extent.height() * (firstRow + tileHeight - m_firstRow) / rows();
+
+            // Top-left of the item rect is the last tile row, which sits at
+            // texture v = tileHeight / capacity
+            const QPointF topLeft = mapFromData(x0, y1);
+            const QPointF bottomRight = mapFromData(x1, y0);
+            const qreal v = qreal(tileHeight) / tile->texture.textureSize().height();
+            QSGGeometry::updateTexturedRectGeometry(&tile->quad, QRectF(topLeft, bottomRight),
+                                                    QRectF(0, v, 1, -v));
+            tile->markDirty(QSGNode::DirtyGeometry);
+        }
+
+        if (uploaded || materialChanged) {
+            tile->markDirty(QSGNode::DirtyMaterial);
+        }
+    }
+
+    m_geometryDirty = false;
+    m_levelsDirty = false;
+    m_colormapDirty = false;
+
+    return root;
+}
@@ -0,0 +1,188 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "Series.hpp"
+
+#include <QByteArray>
+#include <QList>
+#include <QtQml/qqmlregistration.h>
+
+class FloatTexture;
+
+/*!
+    \qmltype ImageSeries
+    \inqmlmodule QuickPlotLib
+    \inherits Series
+    \brief Displays a 2D float array as a colormapped image (heatmap, spectrogram).
+
+    Data is a row-major array of 32-bit floats. It is uploaded once as
+    single-channel float textures and colored on the GPU by ColormapMaterial,
+    so changing vmin, vmax or colormap never re-uploads the data.
+
+    Large images are split into tiles of TileSize x TileSize texels. Appending
+    rows only uploads the new rows into the tiles they fall in; every other
+    tile stays on the GPU untouched.
+
+    The QByteArray passed to setData() or appendRows() is kept by reference
+    (implicitly shared) and uploaded straight from its storage, so the array
+    is never copied on the C++ side. From Python, tobytes() and PySide's
+    bytes-to-QByteArray conversion each make one copy:
+    \code
+    series.setData(spectrum.astype(numpy.float32).tobytes(), spectrum.shape[1])
+    series.appendRows(new_rows.astype(numpy.float32).tobytes())
+    \endcode
+
+    Column indices map to x and row indices to y, with row 0 at the bottom of
+    extent.
+
+    Every appended block stays in memory (and on the GPU) for as long as its
+    rows are shown. For continuously appended data such as a scrolling
+    spectrogram, set maxRows to bound memory: the oldest rows are dropped in
+    whole tiles once more than maxRows rows are held.
+
+    \sa Series, GraphArea
+*/
+class ImageSeries : public Series {
+    Q_OBJECT
+    QML_ELEMENT
+
+    /*!
+        Number of columns (values per row). Read-only, set by setData().
+    */
+    Q_PROPERTY(int columns READ columns NOTIFY dataChanged)
+
+    /*!
+        Number of rows currently held. Read-only, grows with appendRows()
+        and shrinks when maxRows drops old rows.
+    */
+    Q_PROPERTY(int rows READ rows NOTIFY dataChanged)
+
+    /*!
+        Upper bound on the rows kept, or 0 (the default) for no limit. When
+        exceeded, the oldest rows are dropped TileSize rows at a time, so up
+        to maxRows + TileSize - 1 rows may be held. Dropped rows do not
+        renumber the remaining ones: with an empty extent, the image covers
+        Qt.rect(0, firstRow, columns, rows).
+    */
+    Q_PROPERTY(int maxRows READ maxRows WRITE setMaxRows NOTIFY maxRowsChanged)
+
+    /*!
+        Index of the oldest row still held. Read-only, advances when rows are
+        dropped because of maxRows.
+    */
+    Q_PROPERTY(int firstRow READ firstRow NOTIFY dataChanged)
+
+    /*!
+        The data-space rectangle covered by the image.
+        Format: Qt.rect(left, bottom, width, height)
+        An empty rectangle (the default) maps one cell to one data unit,
+        i.e. Qt.rect(0, 0, columns, rows).
+    */
+    Q_PROPERTY(QRectF extent READ extent WRITE setExtent NOTIFY extentChanged)
+
+    /*!
+        The value mapped to the first colormap entry.
+    */
+    Q_PROPERTY(qreal vmin READ vmin WRITE setVmin NOTIFY vminChanged)
+
+    /*!
+        The value mapped to the last colormap entry.
+    */
+    Q_PROPERTY(qreal vmax READ vmax WRITE setVmax NOTIFY vmaxChanged)
+
+    /*!
+        The colormap name (e.g., "viridis", "magma", "gray").
+    */
+    Q_PROPERTY(QString colormap READ colormap WRITE setColormap NOTIFY colormapChanged)
+
+public:
+    /*!
+        Edge length in texels of a single image tile.
+    */
+    static constexpr int TileSize = 1024;
+
+    explicit ImageSeries(QQuickItem *parent = nullptr);
+    ~ImageSeries() override;
+
+    int columns() const { return m_columns; }
+    int rows() const { return m_rows - m_firstRow; }
+    int firstRow() const { return m_firstRow; }
+
+    int maxRows() const { return m_maxRows; }
+    void setMaxRows(int rows);
+
+    QRectF extent() const { return m_extent; }
+    void setExtent(const QRectF &extent);
+
+    qreal vmin() const { return m_vmin; }
+    void setVmin(qreal vmin);
+
+    qreal vmax() const { return m_vmax; }
+    void setVmax(qreal vmax);
+
+    QString colormap() const { return m_colormap; }
+    void setColormap(const QString &colormap);
+
+    /*!
+        Replaces the image with \a data, a row-major float32 array with
+        \a columns values per row. The size of \a data must be a multiple
+        of the row size.
+    */
+    Q_INVOKABLE void setData(const QByteArray &data, int columns);
+
+    /*!
+        Appends whole rows of float32 values to the image. The number of
+        columns is unchanged.
+    */
+    Q_INVOKABLE void appendRows(const QByteArray &data);
+
+    /*!
+        Removes all data.
+    */
+    Q_INVOKABLE void clear();
+
+signals:
+    void dataChanged();
+    void maxRowsChanged();
+    void extentChanged();
+    void vminChanged();
+    void vmaxChanged();
+    void colormapChanged();
+
+protected:
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData) override;
+    void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+
+private:
+    // A block of consecutive rows as handed in by setData()/appendRows()
+    struct Chunk {
+        QByteArray data;
+        int firstRow = 0;
+        int rows = 0;
+    };
+
+    QRectF effectiveExtent() const;
+    bool trimRows();
+    void uploadTileRows(FloatTexture *texture, int tileRow, int tileColumn, int tileWidth,
+                        int firstRow, int endRow) const;
+
+    QList<Chunk> m_chunks;
+    int m_columns = 0;
+    int m_rows = 0;     // End of the held rows; row indices never shift
+    int m_firstRow = 0; // Start of the held rows, a multiple of TileSize
+    int m_maxRows = 0;
+
+    QRectF m_extent;
+    qreal m_vmin = 0;
+    qreal m_vmax = 1;
+    QString m_colormap = "viridis";
+
+    // Bumped whenever existing rows are replaced, forcing a full re-upload
+    int m_dataGeneration = 0;
+
+    bool m_geometryDirty = true;
+    bool m_levelsDirty = true;
+    bool m_colormapDirty = true;
+};
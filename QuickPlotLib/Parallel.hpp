@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QSemaphore>
+#include <QThread>
+#include <QThreadPool>
+#include <QtGlobal>
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+/*!
+    \namespace Parallel
+    \brief Minimal fork-join helpers for data-parallel loops.
+
+    Series that aggregate large arrays split the input into one contiguous
+    slice per worker, let each worker fill private partial results and merge
+    them afterwards, so the hot loops never share writable memory.
+
+    \sa DensitySeries
+*/
+namespace Parallel {
+
+/*!
+    Returns how many workers to use for \a items units of work so that each
+    worker gets at least \a minItemsPerWorker. The result is between 1 and
+    QThread::idealThreadCount().
+*/
+inline int workerCount(qsizetype items, qsizetype minItemsPerWorker)
+{
+    const qsizetype byWork = items / qMax<qsizetype>(1, minItemsPerWorker);
+    return int(qBound<qsizetype>(1, byWork, qMax(1, QThread::idealThreadCount())));
+}
+
+/*!
+    Returns the half-open range [begin, end) of \a items assigned to
+    \a worker out of \a workers.
+*/
+inline std::pair<qsizetype, qsizetype> sliceFor(int worker, int workers, qsizetype items)
+{
+    return { items * worker / workers, items * (worker + 1) / workers };
+}
+
+/*!
+    Calls \a fn(worker) for every worker index in [0, workers) and returns
+    when all calls have finished.
+
+    Helpers run on QThreadPool::globalInstance(), so concurrent callers share
+    one set of threads instead of oversubscribing the CPU. The calling thread
+    claims worker indices too, and only waits for calls already running, so
+    run() finishes even when the pool is saturated or it is called from a
+    pool thread.
+*/
+template <typename Fn>
+void run(int workers, Fn &&fn)
+{
+    if (workers <= 1) {
+        fn(0);
+        return;
+    }
+
+    // Shared with pool tasks that may only start after run() returned; such
+    // late tasks find no index left and never touch fn
+    struct State {
+        std::atomic<int> next { 0 };
+        QSemaphore finished;
+    };
+    auto state = std::make_shared<State>();
+    auto work = [state, workers, &fn]() {
+        for (int worker = state->next.fetch_add(1); worker < workers; worker = state->next.fetch_add(1)) {
+            fn(worker);
+            state->finished.release();
+        }
+    };
+
+    QThreadPool *pool = QThreadPool::globalInstance();
+    for (int helper = 1; helper < workers; ++helper) {
+        pool->start(work);
+    }
+    work();
+    state->finished.acquire(workers);
+}
+
+} // namespace Parallel
@@ -0,0 +1,307 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#include "PointIndex.hpp"
+
+#include "Parallel.hpp"
+
+#include <QtDebug>
+#include <QtMath>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+// Points processed between two cancellation checks while building
+constexpr qsizetype kCancelCheckInterval = 1 << 20;
+
+// Subtrees of at most this many points are left unordered and scanned
+constexpr qsizetype kLeafSize = 16;
+
+// Splits order[begin, end) at its median on x (even depth) or y (odd depth),
+// then does the same for both halves
+void buildSubtree(quint32 *order, const double *px, const double *py, qsizetype begin, qsizetype end, int depth)
+{
+    while (end - begin > kLeafSize) {
+        const qsizetype mid = begin + (end - begin) / 2;
+        const double *axis = (depth & 1) ? py : px;
+        std::nth_element(order + begin, order + mid, order + end,
+                         [axis](quint32 a, quint32 b) { return axis[a] < axis[b]; });
+        buildSubtree(order, px, py, begin, mid, depth + 1);
+        begin = mid + 1;
+        ++depth;
+    }
+}
+
+struct NearestSearch {
+    const quint32 *order;
+    const double *px;
+    const double *py;
+    double x;
+    double y;
+    double rx;
+    double ry;
+
+    // Squared distance in units of the radii; only points with d <= 1 count
+    double best = 1.0;
+    qsizetype bestIndex = -1;
+
+    void consider(qsizetype i)
+    {
+        const double dx = (px[i] - x) / rx;
+        const double dy = (py[i] - y) / ry;
+        const double d = dx * dx + dy * dy;
+        if (d < best || (d == best && (bestIndex < 0 || i < bestIndex))) {
+            best = d;
+            bestIndex = i;
+        }
+    }
+
+    void visit(qsizetype begin, qsizetype end, int depth)
+    {
+        while (end - begin > kLeafSize) {
+            const qsizetype mid = begin + (end - begin) / 2;
+            const quint32 i = order[mid];
+            consider(i);
+
+            // Descend on the query's side first; the other side can only
+            // hold a closer point if the split line is within reach
+            const double diff = (depth & 1) ? (py[i] - y) / ry : (px[i] - x) / rx;
+            const bool queryBelow = diff > 0;
+            if (queryBelow) {
+                visit(begin, mid, depth + 1);
+            } else {
+                visit(mid + 1, end, depth + 1);
+            }
+            if (diff * diff > best) {
+                return;
+            }
+            if (queryBelow) {
+                begin = mid + 1;
+            } else {
+                end = mid;
+            }
+            ++depth;
+        }
+        for (qsizetype k = begin; k < end; ++k) {
+            consider(order[k]);
+        }
+    }
+};
+
+struct RectSearch {
+    const quint32 *order;
+    const double *px;
+    const double *py;
+    double left;
+    double right;
+    double bottom;
+    double top;
+    QList<int> *result;
+
+    void consider(quint32 i)
+    {
+        if (px[i] >= left && px[i] <= right && py[i] >= bottom && py[i] <= top) {
+            result->append(int(i));
+        }
+    }
+
+    void visit(qsizetype begin, qsizetype end, int depth)
+    {
+        while (end - begin > kLeafSize) {
+            const qsizetype mid = begin + (end - begin) / 2;
+            const quint32 i = order[mid];
+            consider(i);
+
+            // Points before mid are <= the split value, points after it >=
+            const double split = (depth & 1) ? py[i] : px[i];
+            const bool lower = ((depth & 1) ? bottom : left) <= split;
+            const bool upper = ((depth & 1) ? top : right) >= split;
+            if (lower && upper) {
+                visit(begin, mid, depth + 1);
+                begin = mid + 1;
+            } else if (lower) {
+                end = mid;
+            } else if (upper) {
+                begin = mid + 1;
+            } else {
+                return;
+            }
+            ++depth;
+        }
+        for (qsizetype k = begin; k < end; ++k) {
+            consider(order[k]);
+        }
+    }
+};
+
+} // namespace
+
+bool PointIndex::build(const QByteArray &x, const QByteArray &y, const std::function<bool()> &superseded)
+{
+    *this = PointIndex();
+
+    qsizetype count = qMin(x.size(), y.size()) / qsizetype(sizeof(double));
+    if (count > std::numeric_limits<int>::max()) {
+        qWarning("PointIndex: only the first %d points are indexed", std::numeric_limits<int>::max());
+        count = std::numeric_limits<int>::max();
+    }
+    if (count == 0) {
+        return true;
+    }
+
+    m_x = x;
+    m_y = y;
+    m_count = count;
+
+    const double *px = xs();
+    const double *py = ys();
+
+    // Monotonic x (e.g. time series) needs no extra structure. The negated
+    // comparison also rejects NaN.
+    bool sorted = !qIsNaN(px[0]);
+    for (qsizetype i = 1; sorted && i < count; ++i) {
+        if (!(px[i] >= px[i - 1])) {
+            sorted = false;
+        }
+        if ((i % kCancelCheckInterval) == 0 && superseded()) {
+            return false;
+        }
+    }
+    if (sorted) {
+        m_mode = Mode::SortedX;
+        return true;
+    }
+
+    // Everything else goes into a k-d tree over the finite points
+    m_order.reserve(size_t(count));
+    for (qsizetype i = 0; i < count; ++i) {
+        if (std::isfinite(px[i]) && std::isfinite(py[i])) {
+            m_order.push_back(quint32(i));
+        }
+        if ((i % kCancelCheckInterval) == 0 && superseded()) {
+            return false;
+        }
+    }
+    if (m_order.empty()) {
+        m_mode = Mode::Empty;
+        return true;
+    }
+
+    // Split the top levels here until there are a few subtrees per worker,
+    // then finish the subtrees in parallel
+    struct Range {
+        qsizetype begin;
+        qsizetype end;
+        int depth;
+    };
+    quint32 *order = m_order.data();
+    const qsizetype finite = qsizetype(m_order.size());
+    const int workers = Parallel::workerCount(finite, kCancelCheckInterval);
+    std::vector<Range> pending { { 0, finite, 0 } };
+    while (!pending.empty() && pending.size() < size_t(workers) * 4) {
+        std::vector<Range> next;
+        for (const Range &range : pending) {
+            if (range.end - range.begin <= kLeafSize) {
+                continue;
+            }
+            const qsizetype mid = range.begin + (range.end - range.begin) / 2;
+            const double *axis = (range.depth & 1) ? py : px;
+            std::nth_element(order + range.begin, order + mid, order + range.end,
+                             [axis](quint32 a, quint32 b) { return axis[a] < axis[b]; });
+            next.push_back({ range.begin, mid, range.depth + 1 });
+            next.push_back({ mid + 1, range.end, range.depth + 1 });
+        }
+        pending = std::move(next);
+        if (superseded()) {
+            return false;
+        }
+    }
+
+    Parallel::run(workers, [&](int worker) {
+        for (size_t k = size_t(worker); k < pending.size(); k += size_t(workers)) {
+            if (superseded()) {
+                return;
+            }
+            buildSubtree(order, px, py, pending[k].begin, pending[k].end, pending[k].depth);
+        }
+    });
+
+    m_mode = Mode::KdTree;
+    return !superseded();
+}
+
+QPointF PointIndex::point(qsizetype index) const
+{
+    if (index < 0 || index >= m_count) {
+        return QPointF();
+    }
+    return QPointF(xs()[index], ys()[index]);
+}
+
+qsizetype PointIndex::nearest(double x, double y, double rx, double ry) const
+{
+    if (m_mode == Mode::Empty || !(rx > 0) || !(ry > 0)) {
+        return -1;
+    }
+
+    const double *px = xs();
+    NearestSearch search { m_order.data(), px, ys(), x, y, rx, ry };
+
+    if (m_mode == Mode::SortedX) {
+        // Scan outward from x and stop once the x distance alone is too far
+        const qsizetype start = std::lower_bound(px, px + m_count, x) - px;
+        for (qsizetype i = start; i < m_count; ++i) {
+            const double dx = (px[i] - x) / rx;
+            if (dx * dx > search.best) {
+                break;
+            }
+            search.consider(i);
+        }
+        for (qsizetype i = start - 1; i >= 0; --i) {
+            const double dx = (px[i] - x) / rx;
+            if (dx * dx > search.best) {
+                break;
+            }
+            search.consider(i);
+        }
+        return search.bestIndex;
+    }
+
+    search.visit(0, qsizetype(m_order.size()), 0);
+    return search.bestIndex;
+}
+
+QList<int> PointIndex::pointsInRect(const QRectF &rect) const
+{
+    QList<int> result;
+    if (m_mode == Mode::Empty) {
+        return result;
+    }
+
+    const QRectF r = rect.normalized();
+    const double left = r.left();
+    const double right = r.right();
+    const double bottom = r.top();
+    const double top = r.bottom();
+
+    const double *px = xs();
+    const double *py = ys();
+
+    if (m_mode == Mode::SortedX) {
+        const qsizetype begin = std::lower_bound(px, px + m_count, left) - px;
+        const qsizetype end = std::upper_bound(px, px + m_count, right) - px;
+        for (qsizetype i = begin; i < end; ++i) {
+            if (py[i] >= bottom && py[i] <= top) {
+                result.append(int(i));
+            }
+        }
+        return result;
+    }
+
+    RectSearch search { m_order.data(), px, py, left, right, bottom, top, &result };
+    search.visit(0, qsizetype(m_order.size()), 0);
+    return result;
+}
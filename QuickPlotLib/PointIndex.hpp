@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QByteArray>
+#include <QList>
+#include <QRectF>
+
+#include <functional>
+#include <vector>
+
+/*!
+    \class PointIndex
+    \brief Immutable spatial index over float64 x/y point arrays for picking.
+
+    PointIndex answers nearest-point and rectangle queries without scanning
+    every point. Its layout depends on the data:
+
+    - SortedX: if x never decreases (time series), queries binary-search x
+      and scan outward, so no extra memory is needed.
+    - KdTree: otherwise the finite points are arranged into an implicit,
+      balanced 2D k-d tree. Each subtree is a range of a permutation array
+      whose median point splits it alternately on x and y, so the tree stays
+      O(log n) deep however clustered the data is or how far outliers lie.
+
+    Building is O(n) for SortedX and O(n log n) for KdTree, parallelized over
+    subtrees, and meant to run off the GUI thread; queries are read-only and
+    safe to call from any thread once build() returned.
+    The index keeps implicitly shared references to the arrays it was
+    built from.
+
+    \sa DensitySeries
+*/
+class PointIndex {
+public:
+    enum class Mode {
+        Empty,
+        SortedX,
+        KdTree
+    };
+
+    /*!
+        Builds the index for \a x and \a y, two float64 arrays of equal
+        length. \a superseded is polled during the build; when it returns
+        true the build stops and returns false.
+    */
+    bool build(const QByteArray &x, const QByteArray &y, const std::function<bool()> &superseded);
+
+    Mode mode() const { return m_mode; }
+    qsizetype count() const { return m_count; }
+
+    /*!
+        Returns the data-space position of point \a index.
+    */
+    QPointF point(qsizetype index) const;
+
+    /*!
+        Returns the index of the point closest to (\a x, \a y) within the
+        ellipse of radii \a rx and \a ry, or -1 if there is none. Distances
+        are measured in units of the radii, so passing the data size of a
+        pixel radius gives a circular search in screen space. Ties resolve
+        to the lowest index. NaN points are never returned.
+    */
+    qsizetype nearest(double x, double y, double rx, double ry) const;
+
+    /*!
+        Returns the indices of all points inside \a rect (inclusive edges),
+        in no particular order. Indices are int so the list can be handed
+        to QML directly; the index supports up to INT_MAX points.
+    */
+    QList<int> pointsInRect(const QRectF &rect) const;
+
+private:
+    const double *xs() const { return reinterpret_cast<const double *>(m_x.constData()); }
+    const double *ys() const { return reinterpret_cast<const double *>(m_y.constData()); }
+
+    QByteArray m_x;
+    QByteArray m_y;
+    qsizetype m_count = 0;
+    Mode m_mode = Mode::Empty;
+
+    // KdTree mode: the subtree over m_order[begin, end) at depth d has its
+    // split point at mid = begin + (end - begin) / 2, splitting on x for even
+    // d and y for odd d; ranges of at most a leaf size are unordered.
+    std::vector<quint32> m_order;
+};
@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#include "Series.hpp"
+
+Series::Series(QQuickItem *parent)
+    : QQuickItem(parent)
+{
+}
+
+Series::~Series() = default;
+
+void Series::setViewRect(const QRectF &rect)
+{
+    if (m_viewRect == rect) {
+        return;
+    }
+    m_viewRect = rect;
+    emit viewRectChanged();
+    update();
+}
+
+QPointF Series::mapFromData(qreal x, qreal y) const
+{
+    if (m_viewRect.width() == 0 || m_viewRect.height() == 0) {
+        return QPointF();
+    }
+
+    // Data y grows upward, item y grows downward
+    qreal px = (x - m_viewRect.left()) / m_viewRect.width() * width();
+    qreal py = height() - (y - m_viewRect.top()) / m_viewRect.height() * height();
+    return QPointF(px, py);
+}
+
+QPointF Series::mapToData(qreal px, qreal py) const
+{
+    if (width() <= 0 || height() <= 0) {
+        return QPointF();
+    }
+
+    qreal x = m_viewRect.left() + px / width() * m_viewRect.width();
+    qreal y = m_viewRect.top() + (height() - py) / height() * m_viewRect.height();
+    return QPointF(x, y);
+}
+
+QRectF Series::mapRectFromData(const QRectF &rect) const
+{
+    QPointF a = mapFromData(rect.left(), rect.top());
+    QPointF b = mapFromData(rect.right(), rect.bottom());
+    return QRectF(a, b).normalized();
+}
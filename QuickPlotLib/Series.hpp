@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QQuickItem>
+#include <QRectF>
+#include <QtQml/qqmlregistration.h>
+
+/*!
+    \qmltype Series
+    \inqmlmodule QuickPlotLib
+    \inherits QQuickItem
+    \brief Abstract base for data series drawn inside a GraphArea.
+
+    A series fills the GraphArea and maps data coordinates to item pixels
+    through viewRect. The x axis grows to the right and the y axis grows
+    upward, matching the tick layout of Axis.
+
+    Series cannot be instantiated directly; use one of the concrete series
+    types and bind its viewRect to the owning GraphArea:
+    \qml
+    ImageSeries {
+        anchors.fill: parent
+        viewRect: graph.viewRect
+    }
+    \endqml
+
+    \sa GraphArea, ImageSeries
+*/
+class Series : public QQuickItem {
+    Q_OBJECT
+    QML_ELEMENT
+    QML_UNCREATABLE("Series is an abstract base type")
+
+    /*!
+        The data-space rectangle visible in the item.
+        Format: Qt.rect(left, bottom, width, height)
+    */
+    Q_PROPERTY(QRectF viewRect READ viewRect WRITE setViewRect NOTIFY viewRectChanged)
+
+public:
+    explicit Series(QQuickItem *parent = nullptr);
+    ~Series() override;
+
+    QRectF viewRect() const { return m_viewRect; }
+    void setViewRect(const QRectF &rect);
+
+    /*!
+        Maps a point in data coordinates to item pixel coordinates.
+    */
+    Q_INVOKABLE QPointF mapFromData(qreal x, qreal y) const;
+
+    /*!
+        Maps a point in item pixel coordinates to data coordinates.
+    */
+    Q_INVOKABLE QPointF mapToData(qreal px, qreal py) const;
+
+    /*!
+        Maps a rectangle in data coordinates to item pixel coordinates.
+        The result is normalized (positive width and height).
+    */
+    QRectF mapRectFromData(const QRectF &rect) const;
+
+signals:
+    void viewRectChanged();
+
+private:
+    QRectF m_viewRect = QRectF(0, 0, 100, 100);
+};
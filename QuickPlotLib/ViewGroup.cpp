@@ -0,0 +1,212 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#include "ViewGroup.hpp"
+
+#include <QMetaProperty>
+#include <QQuickWindow>
+
+#include <functional>
+#include <utility>
+
+namespace {
+
+const char *const kViewRectProperty = "viewRect";
+
+// Empty item in a member's window. Polishing it makes the window run
+// the callback during its polish pass, so polishes requested from there
+// are handled in the same pass.
+class PushPolisher : public QQuickItem {
+public:
+    explicit PushPolisher(std::function<void()> callback)
+        : m_callback(std::move(callback))
+    {
+    }
+
+protected:
+    void updatePolish() override { m_callback(); }
+
+private:
+    std::function<void()> m_callback;
+};
+
+} // namespace
+
+ViewGroup::ViewGroup(QObject *parent)
+    : QObject(parent)
+{
+}
+
+ViewGroup::~ViewGroup()
+{
+    // The polishers call back into this group
+    for (const QPointer<QQuickItem> &polisher : std::as_const(m_polishers)) {
+        delete polisher.data();
+    }
+}
+
+void ViewGroup::setViewRect(const QRectF &rect)
+{
+    if (m_viewRect == rect) {
+        return;
+    }
+    m_viewRect = rect;
+    emit viewRectChanged();
+    schedulePush();
+}
+
+void ViewGroup::setLinkX(bool link)
+{
+    if (m_linkX == link) {
+        return;
+    }
+    m_linkX = link;
+    emit linkXChanged();
+    schedulePush();
+}
+
+void ViewGroup::setLinkY(bool link)
+{
+    if (m_linkY == link) {
+        return;
+    }
+    m_linkY = link;
+    emit linkYChanged();
+    schedulePush();
+}
+
+void ViewGroup::join(QQuickItem *graph)
+{
+    if (!graph || m_members.contains(graph)) {
+        return;
+    }
+
+    const QMetaObject *meta = graph->metaObject();
+    const QMetaProperty property = meta->property(meta->indexOfProperty(kViewRectProperty));
+    if (!property.isValid() || !property.hasNotifySignal()) {
+        qWarning("ViewGroup::join: %s has no notifying viewRect property", meta->className());
+        return;
+    }
+
+    m_members.append(graph);
+    connect(graph, property.notifySignal(), this,
+            staticMetaObject.method(staticMetaObject.indexOfSlot("memberViewRectChanged()")));
+    connect(graph, &QObject::destroyed, this, [this]() {
+        m_members.removeAll(nullptr);
+        emit membersChanged();
+    });
+    connect(graph, &QQuickItem::windowChanged, this, &ViewGroup::watchWindow);
+    watchWindow(graph->window());
+
+    // The first member seeds the shared range
+    if (m_viewRect.isNull()) {
+        m_viewRect = graph->property(kViewRectProperty).toRectF();
+        emit viewRectChanged();
+    }
+
+    emit membersChanged();
+    schedulePush();
+}
+
+void ViewGroup::leave(QQuickItem *graph)
+{
+    if (!graph || !m_members.removeOne(graph)) {
+        return;
+    }
+    disconnect(graph, nullptr, this, nullptr);
+    emit membersChanged();
+}
+
+void ViewGroup::memberViewRectChanged()
+{
+    // Our own push echoes back through every member; ignore it
+    if (m_pushing) {
+        return;
+    }
+
+    auto *graph = qobject_cast<QQuickItem *>(sender());
+    if (!graph) {
+        return;
+    }
+
+    const QRectF rect = graph->property(kViewRectProperty).toRectF();
+    setViewRect(QRectF(m_linkX ? rect.left() : m_viewRect.left(),
+                       m_linkY ? rect.top() : m_viewRect.top(),
+                       m_linkX ? rect.width() : m_viewRect.width(),
+                       m_linkY ? rect.height() : m_viewRect.height()));
+}
+
+void ViewGroup::watchWindow(QQuickWindow *window)
+{
+    if (!window) {
+        return;
+    }
+    m_polishers.removeAll(nullptr);
+    for (const QPointer<QQuickItem> &polisher : std::as_const(m_polishers)) {
+        if (polisher->window() == window) {
+            return;
+        }
+    }
+
+    // Owned by the window's content item, so it goes away with the window
+    auto *polisher = new PushPolisher([this]() { push(); });
+    polisher->setParent(window->contentItem());
+    polisher->setParentItem(window->contentItem());
+    m_polishers.append(polisher);
+}
+
+void ViewGroup::schedulePush()
+{
+    if (m_pushPending || m_members.isEmpty()) {
+        return;
+    }
+    m_pushPending = true;
+
+    // Ask for a polish pass; the push runs once, from whichever polisher
+    // is handled first, and the polishes it causes land in the same pass
+    bool polishRequested = false;
+    for (const QPointer<QQuickItem> &polisher : std::as_const(m_polishers)) {
+        if (polisher) {
+            polisher->polish();
+            polishRequested = true;
+        }
+    }
+
+    // Members not shown in any window yet still need the range
+    if (!polishRequested) {
+        QMetaObject::invokeMethod(this, &ViewGroup::push, Qt::QueuedConnection);
+    }
+}
+
+QRectF ViewGroup::mergedRect(const QRectF &memberRect) const
+{
+    return QRectF(m_linkX ? m_viewRect.left() : memberRect.left(),
+                  m_linkY ? m_viewRect.top() : memberRect.top(),
+                  m_linkX ? m_viewRect.width() : memberRect.width(),
+                  m_linkY ? m_viewRect.height() : memberRect.height());
+}
+
+void ViewGroup::push()
+{
+    if (!m_pushPending) {
+        return;
+    }
+    m_pushPending = false;
+
+    if (m_viewRect.isNull()) {
+        return;
+    }
+
+    m_pushing = true;
+    for (const QPointer<QQuickItem> &graph : std::as_const(m_members)) {
+        if (!graph) {
+            continue;
+        }
+        const QRectF current = graph->property(kViewRectProperty).toRectF();
+        const QRectF target = mergedRect(current);
+        if (target != current) {
+            graph->setProperty(kViewRectProperty, target);
+        }
+    }
+    m_pushing = false;
+}
@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QQuickItem>
+#include <QRectF>
+#include <QtQml/qqmlregistration.h>
+
+class QQuickWindow;
+
+/*!
+    \qmltype ViewGroup
+    \inqmlmodule QuickPlotLib
+    \inherits QObject
+    \brief Links the view ranges of many graphs with one update per frame.
+
+    Graphs join a ViewGroup through their viewGroup property. The group owns
+    the shared range: when any member's viewRect changes, the group records
+    the new range and, once per frame, writes it to every member. Linking
+    16-64 graphs therefore costs one viewRect assignment per graph per frame
+    instead of a cascade of cross-bound QML expressions.
+
+    The push happens inside the window's polish pass: the group polishes an
+    empty helper item in each member's window and writes the range from its
+    updatePolish(). Polishes the new range requests from the graphs' axes
+    and series are handled in the same pass, so each graph lays out exactly
+    once with the final range, in the same frame.
+
+    By default only the x range is shared:
+    \qml
+    ViewGroup { id: timeLink }
+
+    Graph { viewGroup: timeLink }
+    Graph { viewGroup: timeLink }
+    \endqml
+
+    \sa Graph
+*/
+class ViewGroup : public QObject {
+    Q_OBJECT
+    QML_ELEMENT
+
+    /*!
+        The shared view rectangle. Only the linked components are applied to
+        members. Setting it schedules a push to all members for the next
+        frame. If unset, the first member to join provides it.
+    */
+    Q_PROPERTY(QRectF viewRect READ viewRect WRITE setViewRect NOTIFY viewRectChanged)
+
+    /*!
+        Whether members share the x range (left and width). Defaults to true.
+    */
+    Q_PROPERTY(bool linkX READ linkX WRITE setLinkX NOTIFY linkXChanged)
+
+    /*!
+        Whether members share the y range (bottom and height). Defaults to false.
+    */
+    Q_PROPERTY(bool linkY READ linkY WRITE setLinkY NOTIFY linkYChanged)
+
+    /*!
+        Number of member graphs. Read-only.
+    */
+    Q_PROPERTY(int count READ count NOTIFY membersChanged)
+
+public:
+    explicit ViewGroup(QObject *parent = nullptr);
+    ~ViewGroup() override;
+
+    QRectF viewRect() const { return m_viewRect; }
+    void setViewRect(const QRectF &rect);
+
+    bool linkX() const { return m_linkX; }
+    void setLinkX(bool link);
+
+    bool linkY() const { return m_linkY; }
+    void setLinkY(bool link);
+
+    int count() const { return int(m_members.size()); }
+
+    /*!
+        Adds \a graph to the group. \a graph must have a viewRect property.
+        Called by Graph when its viewGroup is set.
+    */
+    Q_INVOKABLE void join(QQuickItem *graph);
+
+    /*!
+        Removes \a graph from the group.
+    */
+    Q_INVOKABLE void leave(QQuickItem *graph);
+
+signals:
+    void viewRectChanged();
+    void linkXChanged();
+    void linkYChanged();
+    void membersChanged();
+
+private slots:
+    // Connected to each member's viewRect notify signal via QMetaProperty
+    void memberViewRectChanged();
+
+private:
+    void watchWindow(QQuickWindow *window);
+    void schedulePush();
+    void push();
+    QRectF mergedRect(const QRectF &memberRect) const;
+
+    QRectF m_viewRect;
+    bool m_linkX = true;
+    bool m_linkY = false;
+
+    QList<QPointer<QQuickItem>> m_members;
+
+    // One helper item per window whose updatePolish() runs push()
+    QList<QPointer<QQuickItem>> m_polishers;
+
+    bool m_pushPending = false;
+    bool m_pushing = false;
+};
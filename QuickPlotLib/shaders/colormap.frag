@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+// SPDX-License-Identifier: MIT
+
+#version 440
+
+layout(location = 0) in vec2 vTexCoord;
+layout(location = 0) out vec4 fragColor;
+
+layout(std140, binding = 0) uniform buf {
+    mat4 qt_Matrix;
+    float qt_Opacity;
+    float vmin;
+    float vmax;
+    float logScale;
+};
+
+layout(binding = 1) uniform sampler2D dataTexture;
+layout(binding = 2) uniform sampler2D lutTexture;
+
+const float LUT_SIZE = 256.0;
+
+void main()
+{
+    float value = texture(dataTexture, vTexCoord).r;
+    if (isnan(value)) {
+        fragColor = vec4(0.0);
+        return;
+    }
+
+    float lo = vmin;
+    float hi = vmax;
+    if (logScale > 0.5) {
+        // Non-positive values clamp to the bottom of the colormap
+        const float tiny = 1e-30;
+        value = log(max(value, tiny));
+        lo = log(max(lo, tiny));
+        hi = log(max(hi, tiny));
+    }
+
+    float range = hi - lo;
+    float t = range != 0.0 ? clamp((value - lo) / range, 0.0, 1.0) : 0.0;
+
+    // Sample texel centers so 0 and 1 hit the first and last LUT entries
+    float u = (t * (LUT_SIZE - 1.0) + 0.5) / LUT_SIZE;
+    fragColor = texture(lutTexture, vec2(u, 0.5)) * qt_Opacity;
+}
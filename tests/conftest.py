@@ -0,0 +1,49 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+# SPDX-License-Identifier: MIT
+
+"""Shared fixtures for headless QuickPlotLib tests."""
+
+import os
+
+import pytest
+from PySide6 import QtCore, QtGui, QtQml
+
+import QuickPlotLib
+
+from .helpers import process_events
+
+os.environ.setdefault("QT_QPA_PLATFORM", "offscreen")
+os.environ.setdefault("QT_QUICK_BACKEND", "software")
+
+
+@pytest.fixture(scope="session")
+def qml_engine():
+    """A QML engine with the QuickPlotLib import path, on an offscreen app."""
+    app = QtGui.QGuiApplication.instance() or QtGui.QGuiApplication([])
+    engine = QtQml.QQmlEngine()
+    engine.addImportPath(QuickPlotLib.QML_IMPORT_PATH)
+    yield engine
+    del engine
+    del app
+
+
+@pytest.fixture
+def create_item(qml_engine):
+    """Create an item from inline QML; it is deleted after the test."""
+    items = []
+
+    def create(source):
+        component = QtQml.QQmlComponent(qml_engine)
+        component.setData(source.encode(), QtCore.QUrl())
+        item = component.create()
+        if item is None and "is not installed" in component.errorString():
+            pytest.skip("QuickPlotLib QML module is not built")
+        assert item is not None, component.errorString()
+        items.append(item)
+        return item
+
+    yield create
+    for item in items:
+        item.deleteLater()
+    process_events()
+
@@ -0,0 +1,42 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+# SPDX-License-Identifier: MIT
+
+"""Helpers for driving QML items from headless tests."""
+
+import time
+
+from PySide6 import QtCore
+
+
+def call(item, method, *args):
+    """Call a QML function of item with QVariant arguments and result."""
+    return QtCore.QMetaObject.invokeMethod(
+        item,
+        method,
+        QtCore.Qt.ConnectionType.DirectConnection,
+        QtCore.Q_RETURN_ARG("QVariant"),
+        *[QtCore.Q_ARG("QVariant", arg) for arg in args],
+    )
+
+
+def process_events():
+    """Run queued calls, including deferred deletes."""
+    QtCore.QCoreApplication.sendPostedEvents(None, QtCore.QEvent.Type.DeferredDelete)
+    QtCore.QCoreApplication.processEvents()
+
+
+def wait_until(predicate, timeout=10.0):
+    """Process events until predicate() is true or timeout seconds pass."""
+    deadline = time.monotonic() + timeout
+    while not predicate():
+        assert time.monotonic() < deadline, "timed out"
+        process_events()
+        time.sleep(0.001)
+
+
+def process_events_for(seconds):
+    """Process events for a while, letting a shown window render frames."""
+    deadline = time.monotonic() + seconds
+    while time.monotonic() < deadline:
+        process_events()
+        time.sleep(0.001)
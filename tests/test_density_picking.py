@@ -0,0 +1,120 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+# SPDX-License-Identifier: MIT
+
+"""Headless tests for DensitySeries point picking."""
+
+import numpy as np
+import pytest
+from PySide6 import QtCore
+
+from .helpers import call, wait_until
+
+# 200x100 pixels over [0, 2] x [0, 1]: 100 pixels per data unit
+DENSITY_QML = """
+import QtQuick
+import QuickPlotLib
+
+DensitySeries {
+    width: 200
+    height: 100
+    viewRect: Qt.rect(0, 0, 2, 1)
+
+    function load(x, y) { setData(new Float64Array(x).buffer, new Float64Array(y).buffer) }
+    function nearest(px, py, radius) { return nearestPoint(px, py, radius) }
+    function inRect(px, py, w, h) { return pointsInRect(Qt.rect(px, py, w, h)) }
+}
+"""
+
+NAN_INDEXES = [10, 20, 30]
+OUTLIER = 40
+
+
+def make_points(sort):
+    """Uniform points with NaN coordinates and one far outlier."""
+    rng = np.random.default_rng(7)
+    x = rng.uniform(0, 2, 5000)
+    y = rng.uniform(0, 1, 5000)
+    if sort:
+        x.sort()
+        # NaN y keeps x sorted; the outlier goes last
+        y[NAN_INDEXES] = np.nan
+        x[-1], y[-1] = 1000.0, -500.0
+        return x, y, len(x) - 1
+    x[10] = np.nan
+    y[20] = np.nan
+    x[30] = y[30] = np.nan
+    x[OUTLIER], y[OUTLIER] = 1000.0, -500.0
+    return x, y, OUTLIER
+
+
+def to_pixels(series, x, y):
+    """Map data to item pixels like Series.mapFromData()."""
+    view = series.property("viewRect")
+    px = (x - view.left()) / view.width() * series.width()
+    py = series.height() - (y - view.top()) / view.height() * series.height()
+    return px, py
+
+
+def brute_nearest(px, py, qx, qy, radius):
+    with np.errstate(invalid="ignore"):
+        d2 = (px - qx) ** 2 + (py - qy) ** 2
+    d2 = np.where(np.isfinite(d2), d2, np.inf)
+    best = int(np.argmin(d2))
+    return best if d2[best] <= radius * radius else -1
+
+
+def brute_in_rect(px, py, left, top, w, h):
+    with np.errstate(invalid="ignore"):
+        inside = (px >= left) & (px <= left + w) & (py >= top) & (py <= top + h)
+    return sorted(np.flatnonzero(inside).tolist())
+
+
+@pytest.fixture(params=[False, True], ids=["scatter", "sorted"])
+def loaded(request, create_item):
+    series = create_item(DENSITY_QML)
+    x, y, outlier = make_points(sort=request.param)
+    call(series, "load", x.tolist(), y.tolist())
+    wait_until(lambda: series.property("indexed"))
+    return series, x, y, outlier
+
+
+def test_nearest_point(loaded):
+    """Test that nearestPoint() matches a brute-force search."""
+    series, x, y, _ = loaded
+    px, py = to_pixels(series, x, y)
+    rng = np.random.default_rng(1)
+    for qx, qy in zip(rng.uniform(-10, 210, 200), rng.uniform(-10, 110, 200)):
+        for radius in (1.0, 5.0, 40.0):
+            expected = brute_nearest(px, py, qx, qy, radius)
+            assert int(call(series, "nearest", qx, qy, radius)) == expected
+
+
+def test_points_in_rect(loaded):
+    """Test that pointsInRect() matches a brute-force search."""
+    series, x, y, _ = loaded
+    px, py = to_pixels(series, x, y)
+    rng = np.random.default_rng(2)
+    for left, top in zip(rng.uniform(-20, 200, 50), rng.uniform(-20, 100, 50)):
+        w, h = rng.uniform(0, 80, 2)
+        found = sorted(int(i) for i in call(series, "inRect", left, top, w, h))
+        assert found == brute_in_rect(px, py, left, top, w, h)
+
+
+def test_nan_points_never_picked(loaded):
+    """Test that points with a NaN coordinate are never returned."""
+    series, _, _, _ = loaded
+    found = {int(i) for i in call(series, "inRect", -1000, -1000, 3000, 3000)}
+    assert len(found) == 5000 - 1 - len(NAN_INDEXES)
+    assert found.isdisjoint(NAN_INDEXES)
+
+
+def test_outlier(loaded):
+    """Test that a far outlier is found once the view reaches it."""
+    series, _, _, outlier = loaded
+    assert int(call(series, "nearest", 100, 50, 50)) != outlier
+
+    # 200x100 pixels over [990, 1010] x [-510, -490]: the outlier is centered
+    series.setProperty("viewRect", QtCore.QRectF(990, -510, 20, 20))
+    assert int(call(series, "nearest", 100, 50, 3)) == outlier
+    assert int(call(series, "nearest", 90, 50, 3)) == -1
+    assert [int(i) for i in call(series, "inRect", 0, 0, 200, 100)] == [outlier]
@@ -0,0 +1,82 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+# SPDX-License-Identifier: MIT
+
+"""Headless tests for Glyph and GlyphMetrics ink bounds."""
+
+import pytest
+from PySide6 import QtGui
+
+from .helpers import call
+
+METRICS_QML = """
+import QtQuick
+import QuickPlotLib
+
+Item {
+    function measure(text, family, size) {
+        return {
+            inkLeft: GlyphMetrics.inkLeft(text, family, size),
+            inkWidth: GlyphMetrics.inkWidth(text, family, size),
+            ascent: GlyphMetrics.ascent(family, size),
+            descent: GlyphMetrics.descent(family, size)
+        }
+    }
+
+    function glyphInk(text, family, size) {
+        glyph.text = text
+        glyph.fontFamily = family
+        glyph.pixelSize = size
+        glyph.ensurePolished()
+        return {
+            inkWidth: glyph.inkWidth,
+            inkHeight: glyph.inkHeight,
+            ascent: glyph.ascent,
+            descent: glyph.descent
+        }
+    }
+
+    Glyph { id: glyph }
+}
+"""
+
+LABELS = ["1", "10.00", "-0.50", "1e-05"]
+SIZES = [12, 17]
+
+# Bounds come from 26.6 fixed-point glyph metrics
+TOLERANCE = 1 / 64 + 1e-6
+
+
+@pytest.fixture
+def metrics(create_item):
+    return create_item(METRICS_QML)
+
+
+def font_metrics(size):
+    font = QtGui.QFont(QtGui.QGuiApplication.font().family())
+    font.setPixelSize(size)
+    return font.family(), QtGui.QFontMetricsF(font)
+
+
+@pytest.mark.parametrize("size", SIZES)
+@pytest.mark.parametrize("text", LABELS)
+def test_glyph_metrics_match_font_metrics(metrics, text, size):
+    """Test that GlyphMetrics ink bounds match QFontMetricsF.boundingRect()."""
+    family, fm = font_metrics(size)
+    expected = fm.boundingRect(text)
+    result = call(metrics, "measure", text, family, size)
+    assert result["inkLeft"] == pytest.approx(expected.left(), abs=TOLERANCE)
+    assert result["inkWidth"] == pytest.approx(expected.width(), abs=TOLERANCE)
+    assert result["ascent"] == pytest.approx(fm.ascent(), abs=TOLERANCE)
+    assert result["descent"] == pytest.approx(fm.descent(), abs=TOLERANCE)
+
+
+@pytest.mark.parametrize("size", SIZES)
+@pytest.mark.parametrize("text", LABELS)
+def test_glyph_ink_matches_font_metrics(metrics, text, size):
+    """Test that Glyph ink width and height match QFontMetricsF."""
+    family, fm = font_metrics(size)
+    result = call(metrics, "glyphInk", text, family, size)
+    assert result["inkWidth"] == pytest.approx(fm.boundingRect(text).width(), abs=TOLERANCE)
+    assert result["inkHeight"] == pytest.approx(fm.tightBoundingRect(text).height(), abs=TOLERANCE)
+    assert result["ascent"] == pytest.approx(fm.ascent(), abs=TOLERANCE)
+    assert result["descent"] == pytest.approx(fm.descent(), abs=TOLERANCE)
@@ -0,0 +1,118 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+# SPDX-License-Identifier: MIT
+
+"""Headless tests for HistogramSeries binning."""
+
+import math
+import time
+
+import pytest
+from PySide6 import QtCore
+
+from .helpers import call
+
+HISTOGRAM_QML = """
+import QuickPlotLib
+
+HistogramSeries {
+    width: 100
+    height: 100
+    binCount: 4
+    minimum: 0
+    maximum: 4
+    autoRange: %s
+    mode: HistogramSeries.%s
+    halfLife: 0.001
+
+    function add(values) { addSamples(new Float64Array(values).buffer) }
+
+    // Samples reach the counts in the next polish; run it right away
+    function drainedCounts() { ensurePolished(); return counts() }
+    function edges() { return binEdges() }
+}
+"""
+
+
+@pytest.fixture
+def histogram(create_item):
+    def create(auto_range=False, mode="Cumulative"):
+        return create_item(HISTOGRAM_QML % ("true" if auto_range else "false", mode))
+
+    return create
+
+
+def test_bin_edges(histogram):
+    """Test that binEdges() spans minimum to maximum in binCount bins."""
+    series = histogram()
+    assert call(series, "edges") == [0.0, 1.0, 2.0, 3.0, 4.0]
+
+
+def test_counts(histogram):
+    """Test that samples land in their bins and others are dropped."""
+    series = histogram()
+    call(series, "add", [0.5, 1.5, 1.25, 3.99, 0.0, 4.0, -0.5, math.nan, math.inf])
+    assert call(series, "drainedCounts") == [2.0, 2.0, 0.0, 1.0]
+    assert series.property("total") == 5.0
+    assert series.property("maxCount") == 2.0
+
+
+def test_counts_accumulate(histogram):
+    """Test that batches add up in Cumulative mode and clear() resets."""
+    series = histogram()
+    call(series, "add", [0.5, 2.5])
+    call(series, "drainedCounts")
+    call(series, "add", [2.5, 3.5])
+    assert call(series, "drainedCounts") == [1.0, 0.0, 2.0, 1.0]
+
+    QtCore.QMetaObject.invokeMethod(series, "clear")
+    assert call(series, "drainedCounts") == [0.0, 0.0, 0.0, 0.0]
+    assert series.property("total") == 0.0
+
+
+def test_auto_range_doubles_and_carries_over(histogram):
+    """Test that autoRange doubles the range and keeps earlier counts."""
+    series = histogram(auto_range=True)
+    call(series, "add", [0.5, 1.5, 2.5, 3.5])
+    assert call(series, "drainedCounts") == [1.0, 1.0, 1.0, 1.0]
+
+    # [0, 4) doubles upward once to [0, 8); old bins merge pairwise
+    call(series, "add", [6.0])
+    assert call(series, "drainedCounts") == [2.0, 2.0, 0.0, 1.0]
+    assert call(series, "edges") == [0.0, 2.0, 4.0, 6.0, 8.0]
+    assert series.property("minimum") == 0.0
+    assert series.property("maximum") == 8.0
+
+    # A sample below grows the range downward: [-8, 8)
+    call(series, "add", [-1.0])
+    assert call(series, "drainedCounts") == [0.0, 1.0, 4.0, 1.0]
+    assert call(series, "edges") == [-8.0, -4.0, 0.0, 4.0, 8.0]
+    assert series.property("total") == 6.0
+
+
+def test_auto_range_carries_over_pending(histogram):
+    """Test that samples not yet drained survive a range change."""
+    series = histogram(auto_range=True)
+    call(series, "add", [0.5, 1.5, 3.5])
+    call(series, "add", [15.0])
+    assert call(series, "drainedCounts") == [3.0, 0.0, 0.0, 1.0]
+    assert call(series, "edges") == [0.0, 4.0, 8.0, 12.0, 16.0]
+
+
+def test_fixed_range_ignores_outliers(histogram):
+    """Test that the range stays put without autoRange."""
+    series = histogram()
+    call(series, "add", [1.5, 100.0, -100.0])
+    assert call(series, "drainedCounts") == [0.0, 1.0, 0.0, 0.0]
+    assert call(series, "edges") == [0.0, 1.0, 2.0, 3.0, 4.0]
+
+
+def test_decay_reaches_zero(histogram):
+    """Test that decayed counts reach exactly zero."""
+    series = histogram(mode="Decay")
+    call(series, "add", [0.5, 1.5, 1.5])
+    assert sum(call(series, "drainedCounts")) > 0
+
+    # 50 half-lives later every count is below the floor
+    time.sleep(0.05)
+    assert call(series, "drainedCounts") == [0.0, 0.0, 0.0, 0.0]
+    assert series.property("total") == 0.0
@@ -0,0 +1,110 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 QuickPlotLib contributors
+# SPDX-License-Identifier: MIT
+
+"""Headless tests for once-per-frame Glyph and AxisLayout updates."""
+
+from .helpers import call, process_events_for, wait_until
+
+GLYPH_WINDOW_QML = """
+import QtQuick
+import QuickPlotLib
+
+Window {
+    id: root
+    width: 200
+    height: 100
+    visible: true
+
+    property int metricsChanges: 0
+
+    function changeFont() {
+        glyph.fontFamily = "monospace"
+        glyph.pixelSize = 20
+        glyph.text = "-1e-05"
+    }
+
+    function glyphState() {
+        return { text: glyph.text, pixelSize: glyph.pixelSize, inkHeight: glyph.inkHeight }
+    }
+
+    Glyph {
+        id: glyph
+        text: "0.00"
+        onMetricsChanged: root.metricsChanges++
+    }
+}
+"""
+
+AXIS_WINDOW_QML = """
+import QtQuick
+import QuickPlotLib
+
+Window {
+    width: 200
+    height: 300
+    visible: true
+
+    function setTicks(values) { axis.ticks = values }
+
+    function layout() {
+        const inkWidth = GlyphMetrics.maxInkWidth(axis.ticks, axis.decimalPoints, axis.fontFamily, axis.fontSize)
+        return {
+            thickness: axis.requiredThickness,
+            expectedThickness: Math.ceil(axis.tickLength + axis.labelGap + inkWidth),
+            width: axis.width,
+            positions: axis.tickPositions
+        }
+    }
+
+    Axis {
+        id: axis
+        direction: Axis.Direction.Left
+        height: 201
+        ticks: [0, 0.5, 1]
+    }
+}
+"""
+
+
+def test_glyph_metrics_change_once_per_frame(create_item):
+    """Test that font and text changes in one frame shape the label once."""
+    window = create_item(GLYPH_WINDOW_QML)
+    wait_until(lambda: window.property("metricsChanges") >= 1)
+    process_events_for(0.1)
+    window.setProperty("metricsChanges", 0)
+
+    call(window, "changeFont")
+    wait_until(lambda: window.property("metricsChanges") >= 1)
+    process_events_for(0.1)
+    assert window.property("metricsChanges") == 1
+
+    state = call(window, "glyphState")
+    assert state["text"] == "-1e-05"
+    assert state["pixelSize"] == 20
+    assert state["inkHeight"] > 0
+
+
+def test_axis_layout_follows_ticks(create_item):
+    """Test that thickness and tick positions follow a range change."""
+    window = create_item(AXIS_WINDOW_QML)
+    wait_until(lambda: len(call(window, "layout")["positions"]) == 3)
+    before = call(window, "layout")
+    assert before["thickness"] == before["expectedThickness"]
+
+    # Wider labels: the axis grows and the ticks are laid out for the new width
+    call(window, "setTicks", [0, 250, 500, 750, 1000])
+    wait_until(lambda: len(call(window, "layout")["positions"]) == 5)
+    process_events_for(0.1)
+    after = call(window, "layout")
+    assert after["thickness"] == after["expectedThickness"]
+    assert after["thickness"] > before["thickness"]
+    assert after["width"] == after["thickness"]
+
+    # Left axis over 201 pixels: ticks from bottom to top on pixel centers
+    positions = after["positions"]
+    assert [p["value"] for p in positions] == [0, 250, 500, 750, 1000]
+    assert [p["spinePoint"].y() for p in positions] == [200.5, 150.5, 100.5, 50.5, 0.5]
+    for p in positions:
+        assert p["spinePoint"].x() == after["width"] - 0.5
+        assert p["endPoint"].x() == after["width"] - 8 + 0.5
+        assert p["endPoint"].y() == p["spinePoint"].y()